@@ -124,6 +124,8 @@ void DefScriptPackage::_InitFunctions(void)
     AddFunc("lmclean",&DefScriptPackage::func_lmclean);
     AddFunc("lerase",&DefScriptPackage::func_lerase);
     AddFunc("lsort",&DefScriptPackage::func_lsort);
+    AddFunc("lsetkind",&DefScriptPackage::func_lsetkind);
+    AddFunc("lcontains",&DefScriptPackage::func_lcontains);
 
     // ByteBuffer functions
     AddFunc("bbinit",&DefScriptPackage::func_bbinit);
@@ -512,7 +514,7 @@ std::string DefScript::GetName(void)
 bool DefScript::AddLine(std::string l){
 	if(l.empty())
 		return false;
-    Line.push_back(l);
+    Line.Add(l);
 	return true;
 }
 
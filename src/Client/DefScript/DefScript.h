@@ -5,6 +5,7 @@
 #include "DefScriptDefines.h"
 #include <map>
 #include <deque>
+#include <set>
 #include <fstream>
 #include "VarSet.h"
 #include "ByteBuffer.h"
@@ -75,7 +76,44 @@ struct DefScriptFunctionEntry {
 
 typedef std::deque<DefScriptFunctionEntry> DefScriptFunctionTable;
 
-typedef std::deque<std::string> DefList;
+// how the elements of a DefList are kept. see DefList::SetKind()
+enum DefListKind
+{
+    DEFLIST_PLAIN = 0, // any order, lookups go through the whole list
+    DEFLIST_SORTED,    // always sorted, lookups are binary searches
+    DEFLIST_SET        // like DEFLIST_SORTED, but every element is stored only once
+};
+
+// list of strings as used by the l* script functions.
+// plain lists are stored in a deque, sorted lists and sets in a multiset, so adding, removing and
+// looking up elements by value is O(log n) for them. accessing them by position walks the set, though.
+class DefList
+{
+public:
+    DefList() { _kind = DEFLIST_PLAIN; }
+    void SetKind(DefListKind k);
+    inline DefListKind GetKind(void) { return _kind; }
+    inline uint32 size(void) { return _kind == DEFLIST_PLAIN ? _plain.size() : _sorted.size(); }
+    inline bool empty(void) { return !size(); }
+    inline void clear(void) { _plain.clear(); _sorted.clear(); }
+    void Assign(const std::deque<std::string>& d); // replace the contents, the kind stays
+    bool Contains(const std::string& s);
+    bool Add(const std::string& s, bool front = false);
+    bool Insert(uint32 pos, const std::string& s);
+    uint32 Remove(const std::string& s);
+    std::string Get(uint32 pos);
+    std::string Erase(uint32 pos);
+    std::string PopFront(void);
+    std::string PopBack(void);
+    std::string Join(uint32 start, uint32 end, const std::string& delim);
+    void Sort(void);
+
+private:
+    DefListKind _kind;
+    std::deque<std::string> _plain;
+    std::multiset<std::string> _sorted;
+};
+
 typedef std::map<std::string,DefList*> DefListMap;
 
 class DefScript {
@@ -84,7 +122,7 @@ public:
 	DefScript(DefScriptPackage *p);
 	~DefScript();
 
-    inline std::string GetLine(unsigned int id) { return Line[id]; }
+    inline std::string GetLine(unsigned int id) { return Line.Get(id); }
     inline unsigned int GetLines(void) { return Line.size(); }
 	bool AddLine(std::string );
 	std::string GetName(void);
@@ -98,7 +136,7 @@ public:
 
 
 private:
-    DefList Line;
+    DefList Line; // also visible to scripts as list, see DefScriptPackage::_UpdateOrCreateScriptByName()
 	unsigned int lines;
 	std::string scriptname;
 	unsigned char permission;
@@ -230,6 +268,8 @@ private:
     DefReturnResult func_lmclean(CmdSet&);
     DefReturnResult func_lerase(CmdSet&);
     DefReturnResult func_lsort(CmdSet&);
+    DefReturnResult func_lsetkind(CmdSet&);
+    DefReturnResult func_lcontains(CmdSet&);
 
     // ByteBuffer functions
     DefReturnResult func_bbinit(CmdSet&);
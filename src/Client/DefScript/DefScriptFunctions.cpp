@@ -199,11 +199,11 @@ DefReturnResult DefScriptPackage::func_add(CmdSet& Set)
     }
 
     std::string vname=_NormalizeVarName(Set.arg[0], Set.myname);
-    ldbl a=toNumber(variables.Get(vname));
+    ldbl a=variables.GetNumber(vname);
     ldbl b=toNumber(Set.defaultarg);
     a+=b;
-    variables.Set(vname,toString(a));
     r.ret=toString(a);
+    variables.Set(vname,r.ret,a);
     return r;
 }
 
@@ -216,11 +216,11 @@ DefReturnResult DefScriptPackage::func_sub(CmdSet& Set)
     }
 
     std::string vname=_NormalizeVarName(Set.arg[0], Set.myname);
-    ldbl a=toNumber(variables.Get(vname));
+    ldbl a=variables.GetNumber(vname);
     ldbl b=toNumber(Set.defaultarg);
     a-=b;
-    variables.Set(vname,toString(a));
     r.ret=toString(a);
+    variables.Set(vname,r.ret,a);
     return r;
 }
 
@@ -233,11 +233,11 @@ DefReturnResult DefScriptPackage::func_mul(CmdSet& Set)
     }
 
     std::string vname=_NormalizeVarName(Set.arg[0], Set.myname);
-    ldbl a=toNumber(variables.Get(vname));
+    ldbl a=variables.GetNumber(vname);
     ldbl b=toNumber(Set.defaultarg);
     a*=b;
-    variables.Set(vname,toString(a));
     r.ret=toString(a);
+    variables.Set(vname,r.ret,a);
     return r;
 }
 
@@ -250,14 +250,14 @@ DefReturnResult DefScriptPackage::func_div(CmdSet& Set)
     }
 
     std::string vname=_NormalizeVarName(Set.arg[0], Set.myname);
-    ldbl a=toNumber(variables.Get(vname));
+    ldbl a=variables.GetNumber(vname);
     ldbl b=toNumber(Set.defaultarg);
     if(b==0)
         a=0;
     else
         a/=b;
-    variables.Set(vname,toString(a));
     r.ret=toString(a);
+    variables.Set(vname,r.ret,a);
     return r;
 }
 
@@ -290,11 +290,11 @@ DefReturnResult DefScriptPackage::func_pow(CmdSet& Set)
     }
 
     std::string vname=_NormalizeVarName(Set.arg[0], Set.myname);
-    ldbl a=toNumber(variables.Get(vname));
+    ldbl a=variables.GetNumber(vname);
     ldbl b=toNumber(Set.defaultarg);
     a=pow(a,b);
-    variables.Set(vname,toString(a));
     r.ret=toString(a);
+    variables.Set(vname,r.ret,a);
     return r;
 }
 
@@ -6,40 +6,200 @@
 
 using namespace DefScriptTools;
 
+// change the way the list keeps its elements. sorted kinds are sorted right away,
+// sets also lose their duplicates.
+void DefList::SetKind(DefListKind k)
+{
+    if(k == _kind)
+        return;
+    std::deque<std::string> d;
+    if(_kind == DEFLIST_PLAIN)
+        d.swap(_plain);
+    else
+        d.assign(_sorted.begin(), _sorted.end());
+    _sorted.clear();
+    _kind = k;
+    Assign(d);
+}
+
+void DefList::Assign(const std::deque<std::string>& d)
+{
+    clear();
+    if(_kind == DEFLIST_PLAIN)
+        _plain = d;
+    else
+        for(std::deque<std::string>::const_iterator it = d.begin(); it != d.end(); it++)
+            Add(*it);
+}
+
+bool DefList::Contains(const std::string& s)
+{
+    if(_kind == DEFLIST_PLAIN)
+        return std::find(_plain.begin(), _plain.end(), s) != _plain.end();
+    return _sorted.find(s) != _sorted.end();
+}
+
+// append (or prepend) an element to a plain list, or insert it at its place in a sorted one.
+// returns false if the list is a set and already has that element.
+bool DefList::Add(const std::string& s, bool front /* = false */)
+{
+    if(_kind == DEFLIST_PLAIN)
+    {
+        if(front)
+            _plain.push_front(s);
+        else
+            _plain.push_back(s);
+        return true;
+    }
+    if(_kind == DEFLIST_SET && _sorted.find(s) != _sorted.end())
+        return false;
+    _sorted.insert(s);
+    return true;
+}
+
+// insert at a position of a plain list, or append if it is too short (returns false then).
+// sorted lists decide the position themselves.
+bool DefList::Insert(uint32 pos, const std::string& s)
+{
+    if(_kind != DEFLIST_PLAIN)
+        return Add(s);
+    if(pos > _plain.size())
+    {
+        _plain.push_back(s);
+        return false;
+    }
+    _plain.insert(_plain.begin() + pos, s);
+    return true;
+}
+
+// remove every element that equals s, returns the amount of removed elements
+uint32 DefList::Remove(const std::string& s)
+{
+    if(_kind != DEFLIST_PLAIN)
+        return _sorted.erase(s);
+    std::deque<std::string>::iterator first = std::remove(_plain.begin(), _plain.end(), s);
+    uint32 r = uint32(_plain.end() - first);
+    _plain.erase(first, _plain.end());
+    return r;
+}
+
+// element at pos, empty if out of bounds
+std::string DefList::Get(uint32 pos)
+{
+    if(pos >= size())
+        return "";
+    if(_kind == DEFLIST_PLAIN)
+        return _plain[pos];
+    std::multiset<std::string>::iterator it = _sorted.begin();
+    std::advance(it, pos);
+    return *it;
+}
+
+// remove the element at pos and return it, empty if out of bounds
+std::string DefList::Erase(uint32 pos)
+{
+    std::string r;
+    if(pos >= size())
+        return r;
+    if(_kind == DEFLIST_PLAIN)
+    {
+        r = _plain[pos];
+        _plain.erase(_plain.begin() + pos);
+        return r;
+    }
+    std::multiset<std::string>::iterator it = _sorted.begin();
+    std::advance(it, pos);
+    r = *it;
+    _sorted.erase(it);
+    return r;
+}
+
+std::string DefList::PopFront(void)
+{
+    return Erase(0);
+}
+
+std::string DefList::PopBack(void)
+{
+    std::string r;
+    if(empty())
+        return r;
+    if(_kind == DEFLIST_PLAIN)
+    {
+        r = _plain.back();
+        _plain.pop_back();
+        return r;
+    }
+    std::multiset<std::string>::iterator it = _sorted.end();
+    --it;
+    r = *it;
+    _sorted.erase(it);
+    return r;
+}
+
+// elements [start, end) separated by delim. the delimiter is left out only after the last element of the list
+std::string DefList::Join(uint32 start, uint32 end, const std::string& delim)
+{
+    std::string r;
+    uint32 count = size();
+    if(end > count)
+        end = count;
+    if(_kind == DEFLIST_PLAIN)
+    {
+        for(uint32 i = start; i < end; i++)
+        {
+            r += _plain[i];
+            if(i + 1 != count)
+                r += delim;
+        }
+        return r;
+    }
+    if(start >= end)
+        return r;
+    std::multiset<std::string>::iterator it = _sorted.begin();
+    std::advance(it, start);
+    for(uint32 i = start; i < end; i++, it++)
+    {
+        r += *it;
+        if(i + 1 != count)
+            r += delim;
+    }
+    return r;
+}
+
+// sorted kinds are always sorted
+void DefList::Sort(void)
+{
+    if(_kind == DEFLIST_PLAIN)
+        std::sort(_plain.begin(), _plain.end());
+}
+
 DefReturnResult DefScriptPackage::func_lpushback(CmdSet& Set)
 {
 	DefList *l = lists.Get(_NormalizeVarName(Set.arg[0],Set.myname));
-	l->push_back(Set.defaultarg);
-	return true;
+	return l->Add(Set.defaultarg);
 }
 
 DefReturnResult DefScriptPackage::func_lpushfront(CmdSet& Set)
 {
 	DefList *l = lists.Get(_NormalizeVarName(Set.arg[0],Set.myname));
-	l->push_front(Set.defaultarg);
-	return true;
+	return l->Add(Set.defaultarg, true);
 }
 
 DefReturnResult DefScriptPackage::func_lpopback(CmdSet& Set)
 {
-    std::string r;
 	DefList *l = lists.GetNoCreate(_NormalizeVarName(Set.defaultarg,Set.myname));
-    if( (!l) || (!l->size()) ) // cant pop any element if the list doesnt exist or is empty
+    if(!l) // cant pop any element if the list doesnt exist or is empty
         return "";
-	r= l->back();
-	l->pop_back();
-	return r;
+	return l->PopBack();
 }
 
 DefReturnResult DefScriptPackage::func_lpopfront(CmdSet& Set)
 {
-    std::string r;
 	DefList *l = lists.GetNoCreate(_NormalizeVarName(Set.defaultarg,Set.myname));
-    if( (!l) || (!l->size()) ) // cant pop any element if the list doesnt exist or is empty
+    if(!l) // cant pop any element if the list doesnt exist or is empty
         return "";
-	r = l->front();
-	l->pop_front();
-	return r;
+	return l->PopFront();
 }
 
 // delete a list and all its elements
@@ -76,22 +236,10 @@ DefReturnResult DefScriptPackage::func_llen(CmdSet& Set)
 // insert item at some position in the list
 DefReturnResult DefScriptPackage::func_linsert(CmdSet& Set)
 {
-	bool result;
 	DefList *l = lists.Get(_NormalizeVarName(Set.arg[0],Set.myname));
-	unsigned int pos = (unsigned int)toNumber(Set.arg[1]);
-	if(pos > l->size()) // if the list is too short to insert at that pos...
-	{
-		l->push_back(Set.defaultarg); // ... just append at the end
-		result = false;
-	}
-	else
-	{
-        DefList::iterator it = l->begin();
-        advance(it,pos);
-		l->insert(it,Set.defaultarg); // ... else insert at correct position
-		result = true;
-	}
-	return result;
+	// if the list is too short to insert at that pos, just append at the end and return false.
+	// sorted lists decide the position themselves.
+	return l->Insert((unsigned int)toNumber(Set.arg[1]), Set.defaultarg);
 }
 
 // returns the amount of string fragments added to the list
@@ -111,7 +259,7 @@ DefReturnResult DefScriptPackage::func_lsplit(CmdSet& Set)
         {
             std::string tmp;
             tmp = Set.defaultarg[i];
-            l->push_back(tmp);
+            l->Add(tmp);
         }
         return toString((uint64)l->size());
     }
@@ -119,12 +267,12 @@ DefReturnResult DefScriptPackage::func_lsplit(CmdSet& Set)
 	unsigned int p,q=0; // p=position of substr; q=next pos to start searching at
     while( (p = Set.defaultarg.find(Set.arg[1].c_str(),q)) != std::string::npos)
 	{
-		l->push_back( Set.defaultarg.substr(q,p - q) );
+		l->Add( Set.defaultarg.substr(q,p - q) );
 		q = p + Set.arg[1].length();
 	}
 	if(q < Set.defaultarg.length()) // also append the last string fragment (that has no delimiter)
     {
-		l->push_back(Set.defaultarg.c_str() + q);
+		l->Add(Set.defaultarg.c_str() + q);
     }
 	return toString((uint64)l->size());
 }
@@ -143,12 +291,12 @@ DefReturnResult DefScriptPackage::func_lcsplit(CmdSet& Set)
 	unsigned int p,q=0; // p=position of substr; q=next pos to start searching at
     while( (p = Set.defaultarg.find_first_of(Set.arg[1].c_str(),q)) != std::string::npos)
 	{
-		l->push_back( Set.defaultarg.substr(q,p - q) );
+		l->Add( Set.defaultarg.substr(q,p - q) );
 		q = p + 1;
 	}
 	if(q < Set.defaultarg.length()) // also append the last string fragment (that has no delimiter)
     {
-		l->push_back(Set.defaultarg.c_str() + q);
+		l->Add(Set.defaultarg.c_str() + q);
     }
 	return toString((uint64)l->size());
 }
@@ -156,7 +304,6 @@ DefReturnResult DefScriptPackage::func_lcsplit(CmdSet& Set)
 // create a string from a list, using <defaultarg> as delimiter
 DefReturnResult DefScriptPackage::func_ljoin(CmdSet& Set)
 {
-    std::string r;
     DefList *l = lists.GetNoCreate(_NormalizeVarName(Set.arg[0],Set.myname));
 	if(!l)
 		return "";
@@ -164,13 +311,7 @@ DefReturnResult DefScriptPackage::func_ljoin(CmdSet& Set)
     unsigned int end_at = (unsigned int)toUint64(Set.arg[2]);
     if(!end_at)
         end_at = l->size();
-	for(unsigned int i = start_from; i < end_at; i++)
-	{
-		r += (*l)[i];
-		if( i+1 != l->size() )
-			r += Set.defaultarg;
-	}			
-	return r;
+	return l->Join(start_from, end_at, Set.defaultarg);
 }
 
 // return list item at position xx
@@ -179,31 +320,17 @@ DefReturnResult DefScriptPackage::func_lindex(CmdSet& Set)
     DefList *l = lists.GetNoCreate(_NormalizeVarName(Set.arg[0],Set.myname));
     if(!l)
         return "";
-    unsigned int pos = (unsigned int)toNumber(Set.defaultarg);
-    if(pos+1 > l->size()) // ot of bounds?
-        return "";
-    return (*l)[pos];
+    return l->Get((unsigned int)toNumber(Set.defaultarg)); // empty if out of bounds
 }
 
 // clean list: remove every element that matches @def
 // use _only_ this function to remove empty strings from a list
 DefReturnResult DefScriptPackage::func_lclean(CmdSet& Set)
 {
-    unsigned int r=0;
     DefList *l = lists.GetNoCreate(_NormalizeVarName(Set.arg[0],Set.myname));
     if(!l)
         return "";
-    for(DefList::iterator i=l->begin(); i!=l->end(); )
-    {
-        if(*i == Set.defaultarg)
-        {
-            i = l->erase(i);
-            r++;
-            continue;
-        }
-        i++;
-    }
-    return toString((uint64)r);
+    return toString((uint64)l->Remove(Set.defaultarg));
 }
 
 // multi-clean list: remove every element that matches any of the args, if it isn't empty
@@ -222,32 +349,12 @@ DefReturnResult DefScriptPackage::func_lmclean(CmdSet& Set)
     for( ; it != Set.arg.end(); it++)
     {
         if(it->second.length())
-        {
-            for(DefList::iterator i=l->begin(); i!=l->end(); i++)
-            {
-                if(*i == it->second)
-                {
-                    l->erase(i);
-                    r++;
-                    if(i==l->end()) // must be checked here, else causing crash (?!)
-                        break;
-                }
-            }
-        }
+            r += l->Remove(it->second);
     }
 
     // erase defaultarg if given
     if(Set.defaultarg.length())
-    {
-        for(DefList::iterator i=l->begin(); i!=l->end(); i++)
-        {
-            if(*i == Set.defaultarg)
-            {
-                l->erase(i);
-                r++;
-            }
-        }
-    }
+        r += l->Remove(Set.defaultarg);
     return toString((uint64)r);
 }
 
@@ -257,17 +364,8 @@ DefReturnResult DefScriptPackage::func_lerase(CmdSet& Set)
     DefList *l = lists.GetNoCreate(_NormalizeVarName(Set.arg[0],Set.myname));
     if(!l)
         return "";
-    std::string r;
-    unsigned int pos = (unsigned int)toNumber(Set.defaultarg);
-    if(pos > l->size()) // if the list is too short to erase at that pos...
-        return ""; // ... return nothing
-
-    DefList::iterator it = l->begin();
-    advance(it,pos);
-    r = *it;
-    l->erase(it); // ... else erase at correct position
-
-    return r;
+    // if the list is too short to erase at that pos, return nothing
+    return l->Erase((unsigned int)toNumber(Set.defaultarg));
 }
 
 DefReturnResult DefScriptPackage::func_lsort(CmdSet& Set)
@@ -275,10 +373,36 @@ DefReturnResult DefScriptPackage::func_lsort(CmdSet& Set)
     DefList *l = lists.GetNoCreate(_NormalizeVarName(Set.defaultarg,Set.myname));
     if(!l)
         return false;
-    sort(l->begin(),l->end());
+    l->Sort();
+    return true;
+}
+
+// set how a list keeps its elements. arg0: list name; defaultarg: "plain", "sorted" or "set"
+// sorted lists and sets are much faster to search with lcontains and to clean with lclean/lmclean,
+// but they ignore positions given to linsert/lpushfront.
+DefReturnResult DefScriptPackage::func_lsetkind(CmdSet& Set)
+{
+    DefListKind k;
+    std::string kind = stringToLower(Set.defaultarg);
+    if(kind == "plain")
+        k = DEFLIST_PLAIN;
+    else if(kind == "sorted")
+        k = DEFLIST_SORTED;
+    else if(kind == "set")
+        k = DEFLIST_SET;
+    else
+        return false;
+    lists.Get(_NormalizeVarName(Set.arg[0],Set.myname))->SetKind(k);
     return true;
 }
 
+// returns true if the list arg0 has an element equal to @def
+DefReturnResult DefScriptPackage::func_lcontains(CmdSet& Set)
+{
+    DefList *l = lists.GetNoCreate(_NormalizeVarName(Set.arg[0],Set.myname));
+    return l && l->Contains(Set.defaultarg);
+}
+
 
 
 
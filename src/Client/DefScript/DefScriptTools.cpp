@@ -25,11 +25,23 @@ std::string DefScriptTools::stringToUpper(std::string s)
 
 std::string DefScriptTools::toString(ldbl num)
 {
-    std::stringstream ss;
-    ss.setf(std::ios_base::fixed);
-    ss.precision(15);
-    ss << Round(num,15);
-    std::string s(ss.str());
+    // same format as a stringstream with std::ios_base::fixed and precision 15 would write,
+    // but without constructing a stream for every number. very large numbers do not fit into the buffer,
+    // let the stream handle those.
+    char buf[64];
+    num = Round(num,15);
+    int len = snprintf(buf, sizeof(buf), "%.15Lf", num);
+    std::string s;
+    if(len > 0 && len < (int)sizeof(buf))
+        s.assign(buf, len);
+    else
+    {
+        std::stringstream ss;
+        ss.setf(std::ios_base::fixed);
+        ss.precision(15);
+        ss << num;
+        s = ss.str();
+    }
     while(s[s.length()-1]=='0')
         s.erase(s.length()-1,1);
     if(s[s.length()-1]=='.')
@@ -4,7 +4,9 @@
 #include <fstream>
 #include <algorithm>
 #include <cctype>
+#include <math.h>
 #include "VarSet.h"
+#include "DefScriptTools.h"
 
 VarSet::VarSet()
 {
@@ -15,33 +17,70 @@ VarSet::~VarSet()
 	Clear();
 }
 
-std::string VarSet::Get(std::string varname)
+Var *VarSet::_Find(const std::string& varname)
 {
     for(std::deque<Var>::iterator i=buffer.begin();i!=buffer.end();i++)
 		if( i->name==varname )
-			return i->value;
+			return &(*i);
+    return NULL;
+}
+
+std::string VarSet::Get(std::string varname)
+{
+    Var *v = _Find(varname);
+    if(v)
+        return v->value;
     return ""; // if var has not been set return empty string
 }
 
+// returns the same as toNumber(Get(varname)), but parses the string only once
+// and keeps the result until the var is set again.
+ldbl VarSet::GetNumber(std::string varname)
+{
+    Var *v = _Find(varname);
+    if(!v)
+        return 0;
+    if(!v->hasnum)
+    {
+        v->num = DefScriptTools::toNumber(v->value);
+        v->hasnum = true;
+    }
+    return v->num;
+}
+
 void VarSet::Set(std::string varname, std::string varvalue)
 {
 	if(varname.empty())
         return;
-	for(std::deque<Var>::iterator i = buffer.begin();i!=buffer.end();i++)
+    Var *v = _Find(varname);
+    if(v)
     {
-		if( i->name==varname )
-        {
-			i->value=varvalue;
-			return;
-		}
-	}
-    Var v;
-    v.name=varname;
-    v.value=varvalue;
-    buffer.push_back(v);
+        v->value=varvalue;
+        v->hasnum=false;
+        return;
+    }
+    Var nv;
+    nv.name=varname;
+    nv.value=varvalue;
+    buffer.push_back(nv);
 	return;
 }
 
+// set a var to a number that was just formatted into varvalue by toString(),
+// so that arithmetic on it does not have to parse the string again.
+// only whole numbers are cached right away: for them toNumber(toString(num)) is num again,
+// for fractions it may differ in the last bits, so they are parsed on the next GetNumber() like any other string.
+void VarSet::Set(std::string varname, std::string varvalue, ldbl num)
+{
+    Set(varname,varvalue);
+    Var *v = _Find(varname);
+    if(v && num == floor(num) && fabs(num) < 1e8)
+    {
+        v->num = num ? num : 0; // toNumber() never returns -0
+        v->hasnum = true;
+    }
+}
+
 unsigned int VarSet::Size(void)
 {
     return buffer.size();
@@ -3,17 +3,23 @@
 
 #include <string>
 #include <deque>
+#include "DefScriptDefines.h"
 
 
 struct Var {
+    Var() { num=0; hasnum=false; }
     std::string name, value;
+    ldbl num; // numeric value of the string, cached. only valid if hasnum is set.
+    bool hasnum;
 };
 	
 
 class VarSet {
 public:
     void Set(std::string,std::string);
+    void Set(std::string,std::string,ldbl);
     std::string Get(std::string);
+    ldbl GetNumber(std::string);
 	void Clear(void);
 	void Unset(std::string);
 	unsigned int Size(void);
@@ -25,6 +31,7 @@ public:
 	// far future: MergeWith(VarSet,bool overwrite);
 
 private:
+    Var *_Find(const std::string&);
     std::deque<Var> buffer;
     std::string toLower(std::string);
     std::string toUpper(std::string);
@@ -9,6 +9,8 @@
 #include "World/WorldSession.h"
 #include "World/Channel.h"
 #include "World/CacheHandler.h"
+#include "World/World.h"
+#include "World/MovementMgr.h"
 #include "SCPDatabase.h"
 #include "MemoryDataHolder.h"
 
@@ -62,6 +64,11 @@ void DefScriptPackage::_InitDefScriptInterface(void)
     AddFunc("loaddb",&DefScriptPackage::SCLoadDB);
     AddFunc("adddbpath",&DefScriptPackage::SCAddDBPath);
     AddFunc("preloadfile",&DefScriptPackage::SCPreloadFile);
+    AddFunc("moveto",&DefScriptPackage::SCMoveTo);
+    AddFunc("lgetobjectsinrange",&DefScriptPackage::SCGetObjectsInRange);
+    AddFunc("getnearestobject",&DefScriptPackage::SCGetNearestObject);
+    AddFunc("watchvalues",&DefScriptPackage::SCWatchValues);
+    AddFunc("unwatchvalues",&DefScriptPackage::SCUnwatchValues);
 }
 
 DefReturnResult DefScriptPackage::SCshdn(CmdSet& Set)
@@ -381,10 +388,12 @@ DefReturnResult DefScriptPackage::SCloadscp(CmdSet& Set)
 // db & key will be stored, that multiple calls like GetScpValue entryxyz are possible
 DefReturnResult DefScriptPackage::SCGetScpValue(CmdSet& Set)
 {
-    static std::string dbname;
-    static uint32 keyid;
     std::string entry;
     SCPDatabaseMgr& dbmgr = ((PseuInstance*)parentMethod)->dbmgr;
+    // scripts mostly read the same field of many rows, the db and column are kept per instance
+    SCPValueLookup& lk = ((PseuInstance*)parentMethod)->scpvalue;
+    std::string& dbname = lk.dbname;
+    uint32& keyid = lk.keyid;
 
     if(!Set.arg[0].empty())
         dbname=Set.arg[0];
@@ -394,25 +403,37 @@ DefReturnResult DefScriptPackage::SCGetScpValue(CmdSet& Set)
         entry=Set.defaultarg;
     if( (!entry.empty()) && (!dbname.empty()) )
     {
-        SCPDatabase *db = dbmgr.GetDB(dbname);
+        if(lk.cachedbname.empty() || lk.generation != dbmgr.GetGeneration() || lk.cachedbname != dbname || lk.cacheentry != entry)
+        {
+            lk.generation = dbmgr.GetGeneration();
+            lk.cachedbname = dbname;
+            lk.cacheentry = entry;
+            lk.db = dbmgr.GetDB(dbname);
+            lk.col = lk.db ? lk.db->GetColumn(entry.c_str()) : SCPColumn();
+        }
+        SCPDatabase *db = lk.db;
+        const SCPColumn& col = lk.col;
         if(db)
         {
-            uint32 ftype = db->GetFieldType((char*)entry.c_str());
-            switch(ftype)
+            if(!col.IsValid())
+            {
+                logerror("GetSCPValue: field '%s' does not exist in DB '%s'!",entry.c_str(),dbname.c_str());
+                return "";
+            }
+            switch(col.type)
             {
                 case SCP_TYPE_INT:
                 {
-                    return DefScriptTools::toString(db->GetInt(keyid,(char*)entry.c_str()));
+                    return DefScriptTools::toString(db->GetInt(keyid,col));
                 }
                 case SCP_TYPE_FLOAT:
                 {
-                    return DefScriptTools::toString(db->GetFloat(keyid,(char*)entry.c_str()));
+                    return DefScriptTools::toString(db->GetFloat(keyid,col));
                 }
                 case SCP_TYPE_STRING:
                 {
-                    return std::string(db->GetString(keyid,(char*)entry.c_str()));
+                    return std::string(db->GetString(keyid,col));
                 }
-                default: logerror("GetSCPValue: field '%s' does not exist in DB '%s'!",entry.c_str(),dbname.c_str());
             }
         }
         else
@@ -803,24 +824,24 @@ DefReturnResult DefScriptPackage::SCGetItemProtoValue(CmdSet& Set)
 DefReturnResult DefScriptPackage::SCGetFileList(CmdSet& Set)
 {
     DefList *l = lists.Get(_NormalizeVarName(Set.arg[0],Set.myname));
-    l->clear();
-    *l = (DefList)GetFileList(Set.defaultarg);
+    std::deque<std::string> files = GetFileList(Set.defaultarg);
     if(Set.arg[1].length())
     {
         std::string ext = ".";
         ext += Set.arg[1];
         ext = stringToLower(ext);
-        for(DefList::iterator i = l->begin(); i != l->end(); )
+        for(std::deque<std::string>::iterator i = files.begin(); i != files.end(); )
         {
             std::string tmp = stringToLower(i->c_str() + (i->length() - ext.length()));
             if( tmp != ext )
             {
-                i = l->erase(i);
+                i = files.erase(i);
                 continue;
             }
             i++;
         }
     }
+    l->Assign(files); // keeps the kind of the list
     return toString((uint64)l->size());
 }
 
@@ -1236,6 +1257,110 @@ DefReturnResult DefScriptPackage::SCPreloadFile(CmdSet& Set)
     return true;
 }
 
+// walk to position (arg0, arg1) on the current map. returns false if no path was found.
+DefReturnResult DefScriptPackage::SCMoveTo(CmdSet& Set)
+{
+    WorldSession *ws = ((PseuInstance*)parentMethod)->GetWSession();
+    if(!ws || !ws->GetWorld() || !ws->GetWorld()->GetMoveMgr())
+    {
+        logerror("Invalid Script call: SCMoveTo: not in world");
+        DEF_RETURN_ERROR;
+    }
+    float x = (float)DefScriptTools::toNumber(Set.arg[0]);
+    float y = (float)DefScriptTools::toNumber(Set.arg[1]);
+    return ws->GetWorld()->GetMoveMgr()->MoveTo(x,y);
+}
+
+// fill list arg0 with the guids of all objects within range arg1 around object <defaultarg> (or ourselves), nearest first.
+// arg2 is an optional TYPE_* mask. returns the amount of objects found.
+DefReturnResult DefScriptPackage::SCGetObjectsInRange(CmdSet& Set)
+{
+    WorldSession *ws = ((PseuInstance*)parentMethod)->GetWSession();
+    if(!ws)
+    {
+        logerror("Invalid Script call: SCGetObjectsInRange: WorldSession not valid");
+        DEF_RETURN_ERROR;
+    }
+    DefList *l = lists.Get(_NormalizeVarName(Set.arg[0],Set.myname));
+    l->clear();
+    uint64 guid = DefScriptTools::toUint64(Set.defaultarg);
+    Object *center = ws->objmgr.GetObj(guid ? guid : ws->GetGuid());
+    if(!center || !center->IsWorldObject())
+        return "0";
+    WorldObject *wo = (WorldObject*)center;
+    float range = (float)DefScriptTools::toNumber(Set.arg[1]);
+    uint8 typemask = (uint8)DefScriptTools::toNumber(Set.arg[2]);
+    std::vector<WorldObject*> objs;
+    ws->objmgr.GetGrid().GetNearestObjects(wo->GetX(), wo->GetY(), range, uint32(-1), objs, typemask);
+    for(uint32 i = 0; i < objs.size(); i++)
+        if(objs[i] != wo)
+            l->Add(toString(objs[i]->GetGUID()));
+    return toString((uint64)l->size());
+}
+
+// guid of the nearest object within range arg0 around object <defaultarg> (or ourselves), "" if there is none.
+// arg1 is an optional TYPE_* mask.
+DefReturnResult DefScriptPackage::SCGetNearestObject(CmdSet& Set)
+{
+    WorldSession *ws = ((PseuInstance*)parentMethod)->GetWSession();
+    if(!ws)
+    {
+        logerror("Invalid Script call: SCGetNearestObject: WorldSession not valid");
+        DEF_RETURN_ERROR;
+    }
+    uint64 guid = DefScriptTools::toUint64(Set.defaultarg);
+    Object *center = ws->objmgr.GetObj(guid ? guid : ws->GetGuid());
+    if(!center || !center->IsWorldObject())
+        return "";
+    WorldObject *wo = (WorldObject*)center;
+    float range = (float)DefScriptTools::toNumber(Set.arg[0]);
+    uint8 typemask = (uint8)DefScriptTools::toNumber(Set.arg[1]);
+    std::vector<WorldObject*> objs;
+    ws->objmgr.GetGrid().GetNearestObjects(wo->GetX(), wo->GetY(), range, 2, objs, typemask); // the center object is likely one of them
+    for(uint32 i = 0; i < objs.size(); i++)
+        if(objs[i] != wo)
+            return toString(objs[i]->GetGUID());
+    return "";
+}
+
+// call script arg0 whenever one of the values arg1...arg2 (offsets, arg2 defaults to arg1) of object <defaultarg>
+// changes. guid 0 watches all objects, optionally only those of typeid arg3.
+// returns the watch id for unwatchvalues, "" on error.
+DefReturnResult DefScriptPackage::SCWatchValues(CmdSet& Set)
+{
+    WorldSession *ws = ((PseuInstance*)parentMethod)->GetWSession();
+    if(!ws)
+    {
+        logerror("Invalid Script call: SCWatchValues: WorldSession not valid");
+        DEF_RETURN_ERROR;
+    }
+    std::string script = DefScriptTools::stringToLower(Set.arg[0]);
+    if(script.empty())
+        return "";
+    uint64 guid = DefScriptTools::toUint64(Set.defaultarg);
+    uint16 first = (uint16)DefScriptTools::toUint64(Set.arg[1]);
+    uint16 last = Set.arg[2].empty() ? first : (uint16)DefScriptTools::toUint64(Set.arg[2]);
+    uint8 tyid = Set.arg[3].empty() ? (uint8)TYPEID_MAX : (uint8)DefScriptTools::toUint64(Set.arg[3]);
+    uint32 id = ws->GetFieldWatch().Add(guid, tyid, first, last, NULL, script);
+    return id ? toString((uint64)id) : "";
+}
+
+// remove the value watch with id <defaultarg>, or all watches calling script arg0.
+DefReturnResult DefScriptPackage::SCUnwatchValues(CmdSet& Set)
+{
+    WorldSession *ws = ((PseuInstance*)parentMethod)->GetWSession();
+    if(!ws)
+    {
+        logerror("Invalid Script call: SCUnwatchValues: WorldSession not valid");
+        DEF_RETURN_ERROR;
+    }
+    if(!Set.arg[0].empty())
+        ws->GetFieldWatch().RemoveScript(DefScriptTools::stringToLower(Set.arg[0]));
+    if(!Set.defaultarg.empty())
+        ws->GetFieldWatch().Remove((uint32)DefScriptTools::toUint64(Set.defaultarg));
+    return "";
+}
+
 void DefScriptPackage::My_LoadUserPermissions(VarSet &vs)
 {
     static const char *prefix = "USERS::";
@@ -52,6 +52,11 @@ DefReturnResult SCLoadDB(CmdSet&);
 DefReturnResult SCAddDBPath(CmdSet&);
 DefReturnResult SCGetPos(CmdSet&);
 DefReturnResult SCPreloadFile(CmdSet&);
+DefReturnResult SCMoveTo(CmdSet&);
+DefReturnResult SCGetObjectsInRange(CmdSet&);
+DefReturnResult SCGetNearestObject(CmdSet&);
+DefReturnResult SCWatchValues(CmdSet&);
+DefReturnResult SCUnwatchValues(CmdSet&);
 
 
 void my_print(const char *fmt, ...);
@@ -8,6 +8,7 @@
 #include <memory.h>
 #include <stdlib.h> // free, malloc and realloc
 #include <string.h>
+#include <algorithm>
 
 namespace irrklang
 {
@@ -15,7 +16,7 @@ namespace irrklang
 CIrrKlangAudioStreamMP3::CIrrKlangAudioStreamMP3(IFileReader* file)
 : File(file), TheMPAuDecContext(0), InputPosition(0), InputLength(0),
 	DecodeBuffer(0), FirstFrameRead(false), EndOfFileReached(0),
-	FileBegin(0), Position(0)
+	FileBegin(0), Position(0), UniformFrameSize(true)
 {
 	if (File)
 	{
@@ -60,7 +61,10 @@ CIrrKlangAudioStreamMP3::CIrrKlangAudioStreamMP3(IFileReader* file)
 					SFramePositionData data;
 					data.size = TheMPAuDecContext->frame_size;
 					data.offset = File->getPos() - (InputLength - InputPosition) - TheMPAuDecContext->coded_frame_size;
+					data.position = Format.FrameCount - data.size;
 
+					if (!FramePositionData.empty() && FramePositionData[0].size != data.size)
+						UniformFrameSize = false;
 					FramePositionData.push_back(data);
 				}
 			}
@@ -143,7 +147,7 @@ ik_s32 CIrrKlangAudioStreamMP3::readFrames(void* target, ik_s32 frameCountToRead
 
 
 
-bool CIrrKlangAudioStreamMP3::decodeFrame()
+bool CIrrKlangAudioStreamMP3::decodeFrame(bool queueOutput)
 {
     int outputSize = 0;
 
@@ -189,7 +193,7 @@ bool CIrrKlangAudioStreamMP3::decodeFrame()
 		return false;
     }
 
-	if (!TheMPAuDecContext->parse_only)
+	if (!TheMPAuDecContext->parse_only && queueOutput)
 	{
 		if (outputSize < 0)
 		{
@@ -248,43 +252,37 @@ bool CIrrKlangAudioStreamMP3::setPosition(ik_s32 pos)
 	{
 		// user wants to seek in the stream, so do this here
 
-		int scan_position = 0;
-		int target_frame = 0;
-		int frame_count = (int)FramePositionData.size();
+		if (FramePositionData.empty())
+			return false;
 
-		while (target_frame < frame_count)
-		{
-			int frame_size = FramePositionData[target_frame].size;
+		const int target_frame = findFrame(pos);
 
-			if (pos <= scan_position + frame_size)
-				break;
-			else
-			{
-				scan_position += frame_size;
-				target_frame++;
-			}
+		// layer 3 frames take part of their data from the frames before them (bit reservoir),
+		// and the synthesis needs the previous frame too. decode just as many frames before
+		// the target as needed, and throw their output away without queueing it.
+		int first_frame = target_frame;
+		int needed = getMainDataBegin(target_frame);
+		while (first_frame > 0 && (first_frame == target_frame || needed > 0))
+		{
+			first_frame--;
+			needed -= getFrameDataSize(first_frame);
 		}
 
-
-		const int MAX_FRAME_DEPENDENCY = 10;
-		target_frame = std::max(0, target_frame - MAX_FRAME_DEPENDENCY);
 		setPosition(0);
 
-		File->seek(FramePositionData[target_frame].offset, false);
+		File->seek(FramePositionData[first_frame].offset, false);
 
-		int i;
-		for (i = 0; i < target_frame; i++)
+		for (int i = first_frame; i < target_frame; i++)
 		{
-			if (i>=(int)FramePositionData.size())
+			if (!decodeFrame(false) || EndOfFileReached)
 			{
-				// internal error
 				setPosition(0);
 				return false;
 			}
-
-			Position += FramePositionData[i].size;
 		}
 
+		Position = FramePositionData[target_frame].position;
+
 		if (!decodeFrame() || EndOfFileReached)
 		{
 			setPosition(0);
@@ -293,11 +291,7 @@ bool CIrrKlangAudioStreamMP3::setPosition(ik_s32 pos)
 
 		int frames_to_consume = pos - Position; // PCM frames now
 		if (frames_to_consume > 0)
-		{
-			ik_u8 *buf = new ik_u8[frames_to_consume * Format.getFrameSize()];
-			readFrames(buf, frames_to_consume);
-			delete[] buf;
-		}
+			Position += DecodedQueue.skip(frames_to_consume * Format.getFrameSize()) / Format.getFrameSize();
 
       	return true;
 	}
@@ -306,10 +300,78 @@ bool CIrrKlangAudioStreamMP3::setPosition(ik_s32 pos)
 }
 
 
+//! index of the mp3 frame that contains PCM frame pos (the last one if pos is behind the end)
+int CIrrKlangAudioStreamMP3::findFrame(ik_s32 pos)
+{
+	const int frame_count = (int)FramePositionData.size();
+	int frame;
+
+	if (UniformFrameSize)
+		frame = pos / FramePositionData[0].size;
+	else
+	{
+		// first frame that starts behind pos, the one before contains it
+		int lo = 0, hi = frame_count;
+		while (lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+			if (FramePositionData[mid].position <= pos)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		frame = lo - 1;
+	}
+
+	return std::max(0, std::min(frame, frame_count - 1));
+}
+
+
+//! how many bytes before its side info a layer 3 frame takes its main data from, 0 for other layers
+int CIrrKlangAudioStreamMP3::getMainDataBegin(int frame)
+{
+	ik_u8 hdr[8];
+
+	File->seek(FramePositionData[frame].offset, false);
+	if (File->read(hdr, sizeof(hdr)) != sizeof(hdr))
+		return 0;
+
+	if (hdr[0] != 0xFF || (hdr[1] & 0xE0) != 0xE0)
+		return 0; // no sync
+
+	if (((hdr[1] >> 1) & 3) != 1)
+		return 0; // not layer 3
+
+	const bool lsf = ((hdr[1] >> 3) & 3) != 3; // MPEG 2 / 2.5
+	const ik_u8* side = (hdr[1] & 1) ? hdr + 4 : hdr + 6; // protection bit not set: 16 bit CRC follows
+
+	if (lsf)
+		return side[0];
+	else
+		return (side[0] << 1) | (side[1] >> 7);
+}
+
+
+//! lower bound for the main data bytes a frame contributes to the bit reservoir
+int CIrrKlangAudioStreamMP3::getFrameDataSize(int frame)
+{
+	const int MAX_HEADER_AND_SIDE_INFO = 4 + 2 + 32;
+	int coded_size;
+
+	if (frame + 1 < (int)FramePositionData.size())
+		coded_size = FramePositionData[frame + 1].offset - FramePositionData[frame].offset;
+	else
+		coded_size = 0;
+
+	return std::max(0, coded_size - MAX_HEADER_AND_SIDE_INFO);
+}
+
+
 CIrrKlangAudioStreamMP3::QueueBuffer::QueueBuffer()
 {
-	Capacity = 256;
+	Capacity = 2 * MPAUDEC_MAX_AUDIO_FRAME_SIZE;
 	Size = 0;
+	Start = 0;
 
 	Buffer = (ik_u8*)malloc(Capacity);
 }
@@ -325,22 +387,37 @@ int CIrrKlangAudioStreamMP3::QueueBuffer::getSize()
 	return Size;
 }
 
+void CIrrKlangAudioStreamMP3::QueueBuffer::grow(int minCapacity)
+{
+	int newCapacity = Capacity;
+	while (newCapacity < minCapacity)
+		newCapacity *= 2;
+
+	// unwrap the content into the new buffer
+	ik_u8* newBuffer = (ik_u8*)malloc(newCapacity);
+	int first = Capacity - Start < Size ? Capacity - Start : Size;
+	memcpy(newBuffer, Buffer + Start, first);
+	memcpy(newBuffer + first, Buffer, Size - first);
+
+	free(Buffer);
+	Buffer = newBuffer;
+	Capacity = newCapacity;
+	Start = 0;
+}
+
 void CIrrKlangAudioStreamMP3::QueueBuffer::write(const void* buffer, int size)
 {
-	bool needRealloc = false;
+	if (size + Size > Capacity)
+		grow(size + Size);
 
-	while (size + Size > Capacity)
-	{
-		Capacity *= 2;
-		needRealloc = true;
-	}
+	int end = Start + Size;
+	if (end >= Capacity)
+		end -= Capacity;
 
-    if (needRealloc)
-	{
-        Buffer = (ik_u8*)realloc(Buffer, Capacity);
-    }
+	int first = Capacity - end < size ? Capacity - end : size;
+	memcpy(Buffer + end, buffer, first);
+	memcpy(Buffer, (const ik_u8*)buffer + first, size - first);
 
-	memcpy(Buffer + Size, buffer, size);
 	Size += size;
 }
 
@@ -349,17 +426,35 @@ int CIrrKlangAudioStreamMP3::QueueBuffer::read(void* buffer, int size)
 {
 	int toRead = size < Size ? size : Size;
 
-	memcpy(buffer, Buffer, toRead);
-	memmove(Buffer, Buffer + toRead, Size - toRead);
+	int first = Capacity - Start < toRead ? Capacity - Start : toRead;
+	memcpy(buffer, Buffer + Start, first);
+	memcpy((ik_u8*)buffer + first, Buffer, toRead - first);
+
+	return skip(toRead);
+}
+
+
+//! drops up to size bytes from the front, returns how many were dropped
+int CIrrKlangAudioStreamMP3::QueueBuffer::skip(int size)
+{
+	int toSkip = size < Size ? size : Size;
+
+	Start += toSkip;
+	if (Start >= Capacity)
+		Start -= Capacity;
+
+	Size -= toSkip;
+	if (!Size)
+		Start = 0;
 
-	Size -= toRead;
-	return toRead;
+	return toSkip;
 }
 
 
 void CIrrKlangAudioStreamMP3::QueueBuffer::clear()
 {
 	Size = 0;
+	Start = 0;
 }
 
 
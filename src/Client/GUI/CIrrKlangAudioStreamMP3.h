@@ -49,8 +49,11 @@ namespace irrklang
 	protected:
 
 		ik_s32 readFrameForMP3(void* target, ik_s32 frameCountToRead, bool parseOnly=false);
-		bool decodeFrame();
+		bool decodeFrame(bool queueOutput=true);
 		void skipID3IfNecessary();
+		int findFrame(ik_s32 pos);
+		int getMainDataBegin(int frame);
+		int getFrameDataSize(int frame);
 
 		irrklang::IFileReader* File;
 		SAudioStreamFormat Format;
@@ -70,7 +73,10 @@ namespace irrklang
 		bool FirstFrameRead;
 		bool EndOfFileReached;
 
-		// helper class for managing the streaming decoded audio data
+		// helper class for managing the streaming decoded audio data.
+		// a ring buffer: reading only moves the start, nothing is moved around.
+		// the capacity is enough for what readFrames() queues (less than one frame plus one decoded mp3 frame),
+		// it only grows if more is written.
 		class QueueBuffer
 		{
 		public:	
@@ -81,22 +87,28 @@ namespace irrklang
 			int getSize();
 			void write(const void* buffer, int size);
 			int read(void* buffer, int size);
+			int skip(int size);
 			void clear();
 
 		private:
 
+			void grow(int minCapacity);
+
 			ik_u8* Buffer;
 			int Capacity;
 			int Size;
+			int Start;
 		};
 
 		struct SFramePositionData
 		{
-			int offset;
-			int size;
+			int offset; // in the file
+			int size; // in PCM frames
+			int position; // PCM frame the mp3 frame starts at
 		};
 
 		std::vector<SFramePositionData> FramePositionData;
+		bool UniformFrameSize; // all mp3 frames have the same PCM size, so a position maps directly to a frame
 		QueueBuffer DecodedQueue;
 	};
 
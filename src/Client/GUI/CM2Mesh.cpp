@@ -15,13 +15,16 @@ namespace scene
 CM2Mesh::CM2Mesh()
 : SkinningBuffers(0), HasAnimation(0), PreparedForSkinning(0),
     AnimationFrames(0.f), LastAnimatedFrame(0.f),
-    AnimateNormals(true), HardwareSkinning(0), InterpolationMode(EIM_LINEAR)
+    AnimateNormals(true), HardwareSkinning(0), InterpolationMode(EIM_LINEAR),
+    PoseFrame(-1.f), PoseClock(0), PoseMissNext(0), PoseCache(false), PoseFrameStep(0)
 {
     #ifdef _DEBUG
     setDebugName("CM2Mesh");
     #endif
 
     SkinningBuffers=&LocalBuffers;
+    for (u32 i=0; i<M2MESH_POSE_CACHE_SIZE; ++i)
+        PoseMisses[i]=-1.f;
 }
 
 
@@ -52,13 +55,192 @@ IMesh* CM2Mesh::getMesh(s32 frame, s32 detailLevel, s32 startFrameLoop, s32 endF
 {
     if (frame==-1)
         return this;
-    animateMesh((f32)frame, 1.0f);
 
+    // see setPoseFrameStep() and setPoseCache()
+    if (HasAnimation && PoseFrameStep > 0 && frame > startFrameLoop && endFrameLoop - startFrameLoop > PoseFrameStep)
+        frame -= (frame - startFrameLoop) % PoseFrameStep;
+    const bool cache = PoseCache && HasAnimation && !HardwareSkinning;
+
+    // the buffers already hold this frame, the usual case for instances playing the same animation
+    if ((f32)frame==PoseFrame)
+        return this;
+
+    if (!cache || (f32)frame==LastAnimatedFrame)
+    {
+        animateMesh((f32)frame, 1.0f);
+        skinMesh();
+        PoseFrame=(f32)frame;
+        return this;
+    }
+
+    M2Pose *pose = findPose((f32)frame);
+    if (pose)
+    {
+        restorePose(*pose);
+        return this;
+    }
+
+    animateMesh((f32)frame, 1.0f);
     skinMesh();
+    // copying the buffers only pays off for frames that are asked for again while others are shown
+    if (notePoseMiss((f32)frame))
+        storePose((f32)frame);
+    else
+        PoseFrame=(f32)frame;
     return this;
 }
 
 
+//--------------------------------------------------------------------------
+//            Pose cache
+//--------------------------------------------------------------------------
+
+// A pose only depends on the frame (blend is always 1 here), so it stays valid
+// until the keyframes, the interpolation or the skinning mode are changed.
+
+M2Pose *CM2Mesh::findPose(f32 frame)
+{
+    for (u32 i=0; i<M2MESH_POSE_CACHE_SIZE; ++i)
+    {
+        if (Poses[i].frame==frame)
+        {
+            Poses[i].lastUsed=++PoseClock;
+            return &Poses[i];
+        }
+    }
+    return 0;
+}
+
+
+//! keeps what skinMesh() just wrote, replacing the least recently used pose
+void CM2Mesh::storePose(f32 frame)
+{
+    core::array<SSkinMeshBuffer*> &buffers=*SkinningBuffers;
+
+    if (PoseBuffers.size()!=buffers.size())
+    {
+        PoseBuffers.set_used(buffers.size());
+        for (u32 i=0; i<PoseBuffers.size(); ++i)
+            PoseBuffers[i]=false;
+        for (u32 i=0; i<AllJoints.size(); ++i)
+            for (u32 j=0; j<AllJoints[i]->Weights.size(); ++j)
+                PoseBuffers[AllJoints[i]->Weights[j].buffer_id]=true;
+    }
+
+    M2Pose *pose=&Poses[0];
+    for (u32 i=1; i<M2MESH_POSE_CACHE_SIZE && pose->frame!=-1.f; ++i)
+    {
+        if (Poses[i].frame==-1.f || Poses[i].lastUsed<pose->lastUsed)
+            pose=&Poses[i];
+    }
+
+    pose->frame=frame;
+    pose->lastUsed=++PoseClock;
+    pose->positions.set_used(buffers.size());
+    pose->normals.set_used(buffers.size());
+    pose->transformations.set_used(buffers.size());
+    pose->boxes.set_used(buffers.size());
+    for (u32 i=0; i<buffers.size(); ++i)
+    {
+        pose->transformations[i]=buffers[i]->Transformation;
+        pose->boxes[i]=buffers[i]->BoundingBox;
+        if (!PoseBuffers[i])
+            continue;
+
+        const u32 count=buffers[i]->getVertexCount();
+        pose->positions[i].set_used(count);
+        if (AnimateNormals)
+            pose->normals[i].set_used(count);
+        for (u32 v=0; v<count; ++v)
+        {
+            const video::S3DVertex *vertex=buffers[i]->getVertex(v);
+            pose->positions[i][v]=vertex->Pos;
+            if (AnimateNormals)
+                pose->normals[i][v]=vertex->Normal;
+        }
+    }
+    pose->box=BoundingBox;
+    PoseFrame=frame;
+}
+
+
+//! writes a kept pose back into the mesh buffers, the joints are left as they are
+void CM2Mesh::restorePose(M2Pose& pose)
+{
+    core::array<SSkinMeshBuffer*> &buffers=*SkinningBuffers;
+
+    for (u32 i=0; i<buffers.size() && i<pose.transformations.size(); ++i)
+    {
+        buffers[i]->Transformation=pose.transformations[i];
+        buffers[i]->BoundingBox=pose.boxes[i];
+        if (!PoseBuffers[i])
+            continue;
+
+        const u32 count=pose.positions[i].size();
+        for (u32 v=0; v<count; ++v)
+        {
+            video::S3DVertex *vertex=buffers[i]->getVertex(v);
+            vertex->Pos=pose.positions[i][v];
+            if (AnimateNormals)
+                vertex->Normal=pose.normals[i][v];
+        }
+        buffers[i]->setDirty();
+    }
+    BoundingBox=pose.box;
+
+    // the joints are still at the frame they were last animated to,
+    // so a direct animateMesh()/skinMesh() call must not be skipped
+    LastAnimatedFrame=-1;
+    SkinnedLastFrame=false;
+    PoseFrame=pose.frame;
+}
+
+
+void CM2Mesh::setPoseCache(bool on)
+{
+    if (!on)
+        clearPoses();
+    PoseCache = on;
+}
+
+
+void CM2Mesh::setPoseFrameStep(s32 ms)
+{
+    PoseFrameStep = ms;
+}
+
+
+//! true if the frame was skinned without keeping it before, otherwise remembers it
+bool CM2Mesh::notePoseMiss(f32 frame)
+{
+    for (u32 i=0; i<M2MESH_POSE_CACHE_SIZE; ++i)
+    {
+        if (PoseMisses[i]==frame)
+        {
+            PoseMisses[i]=-1.f;
+            return true;
+        }
+    }
+    PoseMisses[PoseMissNext]=frame;
+    PoseMissNext=(PoseMissNext+1)%M2MESH_POSE_CACHE_SIZE;
+    return false;
+}
+
+
+void CM2Mesh::clearPoses()
+{
+    for (u32 i=0; i<M2MESH_POSE_CACHE_SIZE; ++i)
+    {
+        Poses[i].frame=-1.f;
+        Poses[i].positions.clear();
+        Poses[i].normals.clear();
+        PoseMisses[i]=-1.f;
+    }
+    PoseBuffers.clear();
+    PoseFrame=-1.f;
+}
+
+
 //--------------------------------------------------------------------------
 //            Keyframe Animation
 //--------------------------------------------------------------------------
@@ -373,6 +555,7 @@ void CM2Mesh::skinMesh()
         return;
 
     SkinnedLastFrame=true;
+    PoseFrame=-1.f;
     if (!HardwareSkinning)
     {
         //Software skin....
@@ -584,6 +767,7 @@ bool CM2Mesh::useAnimationFrom(const ISkinnedMesh *mesh)
     }
 
     checkForAnimation();
+    clearPoses();
 
     return !unmatched;
 }
@@ -594,6 +778,8 @@ bool CM2Mesh::useAnimationFrom(const ISkinnedMesh *mesh)
 //!True= Update normals (default)
 void CM2Mesh::updateNormalsWhenAnimating(bool on)
 {
+    if (AnimateNormals != on)
+        clearPoses();
     AnimateNormals = on;
 }
 
@@ -601,6 +787,8 @@ void CM2Mesh::updateNormalsWhenAnimating(bool on)
 //!Sets Interpolation Mode
 void CM2Mesh::setInterpolationMode(E_INTERPOLATION_MODE mode)
 {
+    if (InterpolationMode != mode)
+        clearPoses();
     InterpolationMode = mode;
 }
 
@@ -628,6 +816,7 @@ bool CM2Mesh::setHardwareSkinning(bool on)
 {
     if (HardwareSkinning!=on)
     {
+        clearPoses();
 
         if (on)
         {
@@ -798,6 +987,7 @@ void CM2Mesh::finalize()
     u32 i;
     LastAnimatedFrame=-1;
     SkinnedLastFrame=false;
+    clearPoses();
 
     //calculate bounding box
 
@@ -1220,6 +1410,7 @@ void CM2Mesh::transferJointsToMesh(const core::array<IBoneSceneNode*> &JointChil
     }
     //Remove cache, temp...
     LastAnimatedFrame=-1;
+    PoseFrame=-1.f;
     SkinnedLastFrame=false;
 }
 
@@ -1286,6 +1477,8 @@ void CM2Mesh::createJoints(core::array<IBoneSceneNode*> &JointChildSceneNodes,
 
 void CM2Mesh::convertMeshToTangents()
 {
+    clearPoses();
+
     // now calculate tangents
     for (u32 b=0; b < LocalBuffers.size(); ++b)
     {
@@ -14,6 +14,24 @@ namespace scene
         u32 begin;
         u32 end;
     };
+
+    //! how many skinned frames a mesh keeps, see CM2Mesh::getMesh()
+    const u32 M2MESH_POSE_CACHE_SIZE = 8;
+    //! frame step for CM2Mesh::setPoseFrameStep(), in ms (about 30 frames per second)
+    const s32 M2MESH_POSE_FRAME_STEP = 33;
+
+    //! the result of skinning a mesh to one frame: everything skinMesh() writes into the mesh buffers
+    struct M2Pose
+    {
+        M2Pose() : frame(-1.f), lastUsed(0) {}
+        f32 frame; // -1: slot unused
+        u32 lastUsed;
+        core::array< core::array<core::vector3df> > positions; // per skinned buffer
+        core::array< core::array<core::vector3df> > normals;
+        core::array<core::matrix4> transformations; // per buffer
+        core::array<core::aabbox3df> boxes;
+        core::aabbox3df box;
+    };
 	class IAnimatedMeshSceneNode;
 	class IBoneSceneNode;
 
@@ -31,6 +49,8 @@ namespace scene
 		virtual u32 getFrameCount() const;
 
 		//! returns the animated mesh based on a detail level (which is ignored)
+		//! all scene nodes showing this mesh share it, so the last few skinned frames are kept
+		//! and an instance on a frame that was already evaluated only copies the result back.
 		virtual IMesh* getMesh(s32 frame, s32 detailLevel=255, s32 startFrameLoop=-1, s32 endFrameLoop=-1);
 
 		//! Animates this mesh's joints based on frame input
@@ -155,10 +175,23 @@ namespace scene
         void setGeoSetRender(u32 id, bool render);
         void setMBRender(u32 id, bool render);
         bool getGeoSetRender(u32 meshbufferNumber);
+        //! keeps skinned frames that are requested again while others are shown, for meshes drawn by
+        //! several nodes, see getMesh(). off by default.
+        void setPoseCache(bool on);
+        //! snaps requested frames to steps of this many ms from the start of the animation, so that nodes
+        //! on nearby frames share one pose. 0 (default): frames are used as they are.
+        void setPoseFrameStep(s32 ms);
 private:
+		friend class CM2MeshCache;
 
 		void checkForAnimation();
 
+		M2Pose *findPose(f32 frame);
+		void storePose(f32 frame);
+		void restorePose(M2Pose& pose);
+		void clearPoses();
+		bool notePoseMiss(f32 frame);
+
 		void normalizeWeights();
 
 		void buildAllAnimatedMatrices(SJoint *Joint=0, SJoint *ParentJoint=0); //public?
@@ -209,6 +242,15 @@ private:
 
         core::array< M2Animation > Animations;
         core::map<u32, core::array<u32> > AnimationLookup;
+
+        M2Pose Poses[M2MESH_POSE_CACHE_SIZE];
+        core::array<bool> PoseBuffers; // buffers moved by any weight, only these are kept in a pose
+        f32 PoseFrame; // frame the buffers hold, the joints are not animated to it if it was restored from a pose
+        u32 PoseClock;
+        f32 PoseMisses[M2MESH_POSE_CACHE_SIZE]; // frames skinned without keeping them, kept once requested again
+        u32 PoseMissNext;
+        bool PoseCache;
+        s32 PoseFrameStep;
 	};
 
 } // end namespace scene
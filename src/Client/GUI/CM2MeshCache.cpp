@@ -0,0 +1,528 @@
+#include "common.h"
+#include "Auth/MD5Hash.h"
+#include "MappedFile.h"
+#include "MemoryInterface.h"
+#include "CM2MeshCache.h"
+
+// increase this number whenever you change something that makes old files unusable
+#define MESHCACHE_VERSION 2
+
+namespace irr
+{
+namespace scene
+{
+
+// all structs are written to the file as they are. the cache is local to the machine that built it,
+// so there is no need to care about endianness or padding as long as the version number is kept up to date.
+struct MeshCacheHeader
+{
+    c8 id[4];
+    u32 version;
+    u8 digest[MESHCACHE_DIGEST_LENGTH];
+    u32 nDependencies;
+    u32 nTextures;
+    u32 nBuffers;
+    u32 nJoints;
+    u32 nAnimations;
+    u32 nAnimationLookups;
+};
+
+struct MeshCacheBuffer
+{
+    u32 geoSetID;
+    u32 geoSetRender;
+    u32 mappingHint;
+    s32 materialType;
+    f32 materialTypeParam;
+    u32 materialFlags;
+    s32 textures[video::MATERIAL_MAX_TEXTURES]; // index into the texture name table, -1 if unused
+    u32 nVertices;
+    u32 nIndices;
+};
+
+enum MeshCacheMaterialFlags
+{
+    MCMF_LIGHTING         = 0x01,
+    MCMF_FOG              = 0x02,
+    MCMF_BACKFACE_CULLING = 0x04,
+};
+
+struct MeshCacheJoint
+{
+    s32 parent;
+    f32 localMatrix[16];
+    f32 globalMatrix[16];
+    f32 globalInversedMatrix[16];
+    core::vector3df position;
+    core::vector3df scale;
+    f32 rotation[4];
+    u32 nPositionKeys;
+    u32 nRotationKeys;
+    u32 nScaleKeys;
+    u32 nWeights;
+    u32 nameLength; // followed by the name, without terminating 0
+};
+
+struct MeshCacheDependency
+{
+    u8 digest[MESHCACHE_DIGEST_LENGTH];
+    u32 exists;
+    u32 nameLength; // followed by the name, without terminating 0
+};
+
+struct MeshCacheWeight
+{
+    u32 buffer_id;
+    u32 vertex_id;
+    f32 strength;
+};
+
+// bounds checked reading from the mapped cache file
+class MeshCacheReader
+{
+public:
+    MeshCacheReader(const u8* data, u32 size) : Pos(data), End(data + size) {}
+
+    bool read(void* dst, u32 size)
+    {
+        if((u32)(End - Pos) < size)
+            return false;
+        memcpy(dst, Pos, size);
+        Pos += size;
+        return true;
+    }
+
+    template <typename T> bool readArray(core::array<T>& arr, u32 count)
+    {
+        if((u32)(End - Pos) / sizeof(T) < count)
+            return false;
+        arr.set_used(count);
+        if(count)
+            memcpy((void*)arr.pointer(), Pos, count * sizeof(T));
+        Pos += count * sizeof(T);
+        return true;
+    }
+
+private:
+    const u8* Pos;
+    const u8* End;
+};
+
+template <typename T> void appendArray(ByteBuffer& bb, const core::array<T>& arr)
+{
+    if(arr.size())
+        bb.append((const uint8*)arr.const_pointer(), arr.size() * sizeof(T));
+}
+
+
+CM2MeshCache::CM2MeshCache(IrrlichtDevice* device, const c8* dir)
+: Device(device), Dir(dir), DirCreated(false)
+{
+}
+
+bool CM2MeshCache::getSourceDigest(io::IReadFile* file, u8* digest)
+{
+    if(!file)
+        return false;
+
+    MD5Hash md5;
+    std::string fn = file->getFileName().c_str();
+    md5.Update(fn);
+
+    u8 buf[4096];
+    file->seek(0);
+    s32 len;
+    while((len = file->read(buf, sizeof(buf))) > 0)
+        md5.Update(buf, len);
+    file->seek(0);
+
+    md5.Finalize();
+    memcpy(digest, md5.GetDigest(), MESHCACHE_DIGEST_LENGTH);
+    return true;
+}
+
+// digest of the contents of a file that belongs to a mesh, false if it does not exist
+bool CM2MeshCache::getFileDigest(const c8* name, u8* digest)
+{
+    io::IReadFile* file = io::IrrCreateIReadFileBasic(Device, name);
+    if(!file)
+        return false;
+
+    MD5Hash md5;
+    u8 buf[4096];
+    s32 len;
+    while((len = file->read(buf, sizeof(buf))) > 0)
+        md5.Update(buf, len);
+    file->drop();
+
+    md5.Finalize();
+    memcpy(digest, md5.GetDigest(), MESHCACHE_DIGEST_LENGTH);
+    return true;
+}
+
+void CM2MeshCache::makeFilename(c8* buf, const u8* digest)
+{
+    std::string hex = toHexDump((uint8*)digest, MESHCACHE_DIGEST_LENGTH, false);
+    sprintf(buf, "%s/%s.mcache", Dir.c_str(), hex.c_str());
+}
+
+video::ITexture* CM2MeshCache::getTexture(const core::stringc& name)
+{
+    video::ITexture* tex = Device->getVideoDriver()->findTexture(name.c_str());
+    if(tex)
+        return tex;
+    io::IReadFile* TexFile = io::IrrCreateIReadFileBasic(Device, name.c_str());
+    if(!TexFile)
+    {
+        logerror("CM2MeshCache: Texture file not found: %s", name.c_str());
+        return 0;
+    }
+    tex = Device->getVideoDriver()->getTexture(TexFile);
+    TexFile->drop();
+    return tex;
+}
+
+CM2Mesh* CM2MeshCache::load(const u8* digest)
+{
+    char fn[1024];
+    makeFilename(fn, digest);
+
+    MappedFile mf;
+    if(!mf.Open(fn))
+        return 0;
+
+    MeshCacheReader r(mf.Data(), mf.Size());
+    MeshCacheHeader hdr;
+    if(!r.read(&hdr, sizeof(hdr)) || memcmp(hdr.id, "PMCH", 4) || hdr.version != MESHCACHE_VERSION
+        || memcmp(hdr.digest, digest, MESHCACHE_DIGEST_LENGTH))
+    {
+        logdetail("CM2MeshCache: '%s' is outdated or not a mesh cache file, ignoring", fn);
+        return 0;
+    }
+
+    // the other files the mesh was built from must still be the same
+    for(u32 i = 0; i < hdr.nDependencies; i++)
+    {
+        MeshCacheDependency dep;
+        c8 name[1024];
+        if(!r.read(&dep, sizeof(dep)) || dep.nameLength >= sizeof(name) || !r.read(name, dep.nameLength))
+        {
+            logerror("CM2MeshCache: '%s' is corrupt", fn);
+            return 0;
+        }
+        name[dep.nameLength] = 0;
+        u8 depdigest[MESHCACHE_DIGEST_LENGTH];
+        bool exists = getFileDigest(name, depdigest);
+        if(exists != (dep.exists != 0) || (exists && memcmp(depdigest, dep.digest, MESHCACHE_DIGEST_LENGTH)))
+        {
+            logdetail("CM2MeshCache: '%s' changed, ignoring '%s'", name, fn);
+            return 0;
+        }
+    }
+
+    // texture name table
+    core::array<core::stringc> texNames;
+    texNames.reallocate(hdr.nTextures);
+    for(u32 i = 0; i < hdr.nTextures; i++)
+    {
+        u16 len;
+        c8 name[1024];
+        if(!r.read(&len, sizeof(u16)) || len >= sizeof(name) || !r.read(name, len))
+        {
+            logerror("CM2MeshCache: '%s' is corrupt", fn);
+            return 0;
+        }
+        name[len] = 0;
+        texNames.push_back(name);
+    }
+
+    CM2Mesh* mesh = new CM2Mesh();
+    bool ok = true;
+
+    for(u32 i = 0; ok && i < hdr.nBuffers; i++)
+    {
+        MeshCacheBuffer mb;
+        if(!r.read(&mb, sizeof(mb)))
+        {
+            ok = false;
+            break;
+        }
+        SSkinMeshBuffer* buffer = mesh->addMeshBuffer(mb.geoSetID);
+        mesh->GeoSetRender[i] = mb.geoSetRender != 0;
+        if(!r.readArray(buffer->Vertices_Standard, mb.nVertices) || !r.readArray(buffer->Indices, mb.nIndices))
+        {
+            ok = false;
+            break;
+        }
+
+        video::SMaterial& mat = buffer->getMaterial();
+        mat.MaterialType = (video::E_MATERIAL_TYPE)mb.materialType;
+        mat.MaterialTypeParam = mb.materialTypeParam;
+        mat.Lighting = (mb.materialFlags & MCMF_LIGHTING) != 0;
+        mat.FogEnable = (mb.materialFlags & MCMF_FOG) != 0;
+        mat.BackfaceCulling = (mb.materialFlags & MCMF_BACKFACE_CULLING) != 0;
+        for(u32 t = 0; t < video::MATERIAL_MAX_TEXTURES; t++)
+        {
+            if(mb.textures[t] < 0)
+                continue;
+            if((u32)mb.textures[t] >= texNames.size())
+            {
+                ok = false;
+                break;
+            }
+            mat.setTexture(t, getTexture(texNames[mb.textures[t]]));
+        }
+        buffer->recalculateBoundingBox();
+        buffer->setHardwareMappingHint((E_HARDWARE_MAPPING)mb.mappingHint);
+    }
+
+    // create all joints first, parents may be stored after their children
+    core::array<s32> parents;
+    for(u32 i = 0; ok && i < hdr.nJoints; i++)
+    {
+        MeshCacheJoint mj;
+        if(!r.read(&mj, sizeof(mj)))
+        {
+            ok = false;
+            break;
+        }
+        c8 name[1024];
+        if(mj.nameLength >= sizeof(name) || !r.read(name, mj.nameLength))
+        {
+            ok = false;
+            break;
+        }
+        name[mj.nameLength] = 0;
+        CM2Mesh::SJoint* joint = mesh->addJoint(0);
+        joint->Name = name;
+        parents.push_back(mj.parent);
+        joint->LocalMatrix.setM(mj.localMatrix);
+        joint->GlobalMatrix.setM(mj.globalMatrix);
+        joint->GlobalInversedMatrix.setM(mj.globalInversedMatrix);
+        joint->Animatedposition = mj.position;
+        joint->Animatedscale = mj.scale;
+        joint->Animatedrotation.set(mj.rotation[0], mj.rotation[1], mj.rotation[2], mj.rotation[3]);
+        if(!r.readArray(joint->PositionKeys, mj.nPositionKeys)
+            || !r.readArray(joint->RotationKeys, mj.nRotationKeys)
+            || !r.readArray(joint->ScaleKeys, mj.nScaleKeys))
+        {
+            ok = false;
+            break;
+        }
+        core::array<MeshCacheWeight> weights;
+        if(!r.readArray(weights, mj.nWeights))
+        {
+            ok = false;
+            break;
+        }
+        joint->Weights.set_used(weights.size());
+        for(u32 w = 0; w < weights.size(); w++)
+        {
+            joint->Weights[w].buffer_id = weights[w].buffer_id;
+            joint->Weights[w].vertex_id = weights[w].vertex_id;
+            joint->Weights[w].strength = weights[w].strength;
+        }
+    }
+    for(u32 i = 0; ok && i < parents.size(); i++)
+    {
+        if(parents[i] < 0)
+            continue;
+        if((u32)parents[i] >= mesh->AllJoints.size())
+            ok = false;
+        else
+            mesh->AllJoints[parents[i]]->Children.push_back(mesh->AllJoints[i]);
+    }
+
+    ok = ok && r.readArray(mesh->Animations, hdr.nAnimations);
+    for(u32 i = 0; ok && i < hdr.nAnimationLookups; i++)
+    {
+        u32 id, count;
+        core::array<u32> indices;
+        ok = r.read(&id, sizeof(u32)) && r.read(&count, sizeof(u32)) && r.readArray(indices, count);
+        if(ok)
+            mesh->AnimationLookup[id] = indices;
+    }
+
+    if(!ok)
+    {
+        logerror("CM2MeshCache: '%s' is corrupt", fn);
+        mesh->drop();
+        return 0;
+    }
+
+    DEBUG(logdebug("CM2MeshCache: Loaded '%s' (%u buffers, %u joints)", fn, hdr.nBuffers, hdr.nJoints));
+    return mesh;
+}
+
+bool CM2MeshCache::save(const u8* digest, CM2Mesh* mesh, const core::array<core::stringc>& dependencies)
+{
+    if(!mesh)
+        return false;
+    if(!DirCreated)
+    {
+        CreateDir(Dir.c_str());
+        DirCreated = true;
+    }
+
+    core::array<core::stringc> texNames;
+    ByteBuffer body;
+
+    for(u32 i = 0; i < mesh->LocalBuffers.size(); i++)
+    {
+        SSkinMeshBuffer* buffer = mesh->LocalBuffers[i];
+        if(buffer->VertexType != video::EVT_STANDARD)
+        {
+            logerror("CM2MeshCache: Can't cache mesh buffer with vertex type %u", buffer->VertexType);
+            return false;
+        }
+        const video::SMaterial& mat = buffer->getMaterial();
+
+        MeshCacheBuffer mb;
+        memset(&mb, 0, sizeof(mb));
+        mb.geoSetID = mesh->GeoSetID[i];
+        mb.geoSetRender = mesh->GeoSetRender[i];
+        mb.mappingHint = buffer->getHardwareMappingHint_Vertex();
+        mb.materialType = mat.MaterialType;
+        mb.materialTypeParam = mat.MaterialTypeParam;
+        mb.materialFlags = (mat.Lighting ? MCMF_LIGHTING : 0) | (mat.FogEnable ? MCMF_FOG : 0)
+            | (mat.BackfaceCulling ? MCMF_BACKFACE_CULLING : 0);
+        for(u32 t = 0; t < video::MATERIAL_MAX_TEXTURES; t++)
+        {
+            video::ITexture* tex = mat.getTexture(t);
+            if(!tex)
+            {
+                mb.textures[t] = -1;
+                continue;
+            }
+            core::stringc name = tex->getName().getPath();
+            s32 idx = texNames.linear_search(name);
+            if(idx < 0)
+            {
+                idx = texNames.size();
+                texNames.push_back(name);
+            }
+            mb.textures[t] = idx;
+        }
+        mb.nVertices = buffer->Vertices_Standard.size();
+        mb.nIndices = buffer->Indices.size();
+
+        body.append((uint8*)&mb, sizeof(mb));
+        appendArray(body, buffer->Vertices_Standard);
+        appendArray(body, buffer->Indices);
+    }
+
+    for(u32 i = 0; i < mesh->AllJoints.size(); i++)
+    {
+        CM2Mesh::SJoint* joint = mesh->AllJoints[i];
+
+        MeshCacheJoint mj;
+        memset((void*)&mj, 0, sizeof(mj));
+        mj.parent = -1;
+        for(u32 p = 0; p < mesh->AllJoints.size() && mj.parent < 0; p++)
+            if(mesh->AllJoints[p]->Children.linear_search(joint) >= 0)
+                mj.parent = p;
+        memcpy(mj.localMatrix, joint->LocalMatrix.pointer(), sizeof(mj.localMatrix));
+        memcpy(mj.globalMatrix, joint->GlobalMatrix.pointer(), sizeof(mj.globalMatrix));
+        memcpy(mj.globalInversedMatrix, joint->GlobalInversedMatrix.pointer(), sizeof(mj.globalInversedMatrix));
+        mj.position = joint->Animatedposition;
+        mj.scale = joint->Animatedscale;
+        mj.rotation[0] = joint->Animatedrotation.X;
+        mj.rotation[1] = joint->Animatedrotation.Y;
+        mj.rotation[2] = joint->Animatedrotation.Z;
+        mj.rotation[3] = joint->Animatedrotation.W;
+        mj.nPositionKeys = joint->PositionKeys.size();
+        mj.nRotationKeys = joint->RotationKeys.size();
+        mj.nScaleKeys = joint->ScaleKeys.size();
+        mj.nWeights = joint->Weights.size();
+        mj.nameLength = joint->Name.size();
+
+        body.append((uint8*)&mj, sizeof(mj));
+        body.append(joint->Name.c_str(), joint->Name.size());
+        appendArray(body, joint->PositionKeys);
+        appendArray(body, joint->RotationKeys);
+        appendArray(body, joint->ScaleKeys);
+        for(u32 w = 0; w < joint->Weights.size(); w++)
+        {
+            MeshCacheWeight mw;
+            mw.buffer_id = joint->Weights[w].buffer_id;
+            mw.vertex_id = joint->Weights[w].vertex_id;
+            mw.strength = joint->Weights[w].strength;
+            body.append((uint8*)&mw, sizeof(mw));
+        }
+    }
+
+    appendArray(body, mesh->Animations);
+    u32 nLookups = 0;
+    for(core::map<u32, core::array<u32> >::Iterator it = mesh->AnimationLookup.getIterator(); !it.atEnd(); it++)
+    {
+        const core::array<u32>& indices = it->getValue();
+        body << (uint32)it->getKey() << (uint32)indices.size();
+        appendArray(body, indices);
+        nLookups++;
+    }
+
+    MeshCacheHeader hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.id, "PMCH", 4);
+    hdr.version = MESHCACHE_VERSION;
+    memcpy(hdr.digest, digest, MESHCACHE_DIGEST_LENGTH);
+    hdr.nDependencies = dependencies.size();
+    hdr.nTextures = texNames.size();
+    hdr.nBuffers = mesh->LocalBuffers.size();
+    hdr.nJoints = mesh->AllJoints.size();
+    hdr.nAnimations = mesh->Animations.size();
+    hdr.nAnimationLookups = nLookups;
+
+    ByteBuffer head;
+    head.append((uint8*)&hdr, sizeof(hdr));
+    for(u32 i = 0; i < dependencies.size(); i++)
+    {
+        MeshCacheDependency dep;
+        memset(&dep, 0, sizeof(dep));
+        dep.exists = getFileDigest(dependencies[i].c_str(), dep.digest);
+        dep.nameLength = dependencies[i].size();
+        head.append((uint8*)&dep, sizeof(dep));
+        head.append(dependencies[i].c_str(), dependencies[i].size());
+    }
+    for(u32 i = 0; i < texNames.size(); i++)
+    {
+        head << (uint16)texNames[i].size();
+        head.append(texNames[i].c_str(), texNames[i].size());
+    }
+
+    // other clients may have the old file mapped, so it is never written in place: the new one is
+    // written completely under a temporary name and then replaces it
+    char fn[1024], tmpfn[1040];
+    makeFilename(fn, digest);
+    sprintf(tmpfn, "%s.tmp", fn);
+    FILE* fh = fopen(tmpfn, "wb");
+    if(!fh)
+    {
+        logerror("CM2MeshCache: Could not write to file '%s'!", tmpfn);
+        return false;
+    }
+    bool ok = fwrite(head.contents(), 1, head.size(), fh) == head.size();
+    if(ok && body.size())
+        ok = fwrite(body.contents(), 1, body.size(), fh) == body.size();
+    ok = (fclose(fh) == 0) && ok;
+    if(!ok)
+    {
+        logerror("CM2MeshCache: Could not write to file '%s'!", tmpfn);
+        remove(tmpfn);
+        return false;
+    }
+#if PLATFORM == PLATFORM_WIN32
+    remove(fn); // rename() does not replace existing files there
+#endif
+    if(rename(tmpfn, fn))
+    {
+        logerror("CM2MeshCache: Could not replace file '%s'!", fn);
+        remove(tmpfn);
+        return false;
+    }
+    DEBUG(logdebug("CM2MeshCache: Saved '%s' (%u bytes)", fn, head.size() + body.size()));
+    return true;
+}
+
+}
+}
@@ -0,0 +1,56 @@
+#ifndef __M2_MESH_CACHE_H_INCLUDED__
+#define __M2_MESH_CACHE_H_INCLUDED__
+
+#include "irrlicht/irrlicht.h"
+#include "CM2Mesh.h"
+
+namespace irr
+{
+namespace scene
+{
+
+//! length of the source file digest the cache files are keyed by (MD5)
+const u32 MESHCACHE_DIGEST_LENGTH = 16;
+
+//! On-disk cache of meshes built by the M2 and WMO loaders.
+//! A cache file holds the mesh buffers, joints, keyframes, weights, animations
+//! and texture names of a mesh exactly as the loader left them before finalize(),
+//! so a cached mesh can be rebuilt with a few bulk copies instead of parsing the model again.
+//! Files are named after the digest of the source file and its name. The .skin/.anim/group files
+//! the mesh was built from are listed in the cache file with their own digests and checked on load,
+//! so a changed model is never served from a stale entry.
+class CM2MeshCache
+{
+public:
+
+	//! Constructor. Cache files are stored in (and read from) the directory dir.
+	CM2MeshCache(IrrlichtDevice* device, const c8* dir);
+
+	//! Calculates the digest of a source file. The file position is reset to 0 afterwards.
+	bool getSourceDigest(io::IReadFile* file, u8* digest);
+
+	//! Creates a mesh from a cache file. Returns 0 if there is no valid cache file for the digest,
+	//! or if one of the files it depends on changed since it was written.
+	//! The mesh is not yet finalized; this is up to the loader.
+	CM2Mesh* load(const u8* digest);
+
+	//! Writes a not yet finalized mesh to the cache. dependencies are the names of all other files
+	//! the mesh was built from, including those that were looked for but did not exist.
+	bool save(const u8* digest, CM2Mesh* mesh, const core::array<core::stringc>& dependencies);
+
+private:
+
+	bool getFileDigest(const c8* name, u8* digest);
+
+	void makeFilename(c8* buf, const u8* digest);
+	video::ITexture* getTexture(const core::stringc& name);
+
+	IrrlichtDevice* Device;
+	core::stringc Dir;
+	bool DirCreated;
+};
+
+}//namespace scene
+}//namespace irr
+
+#endif
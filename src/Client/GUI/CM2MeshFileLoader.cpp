@@ -10,7 +10,7 @@ namespace irr
 namespace scene
 {
 
-CM2MeshFileLoader::CM2MeshFileLoader(IrrlichtDevice* device):Device(device)
+CM2MeshFileLoader::CM2MeshFileLoader(IrrlichtDevice* device, CM2MeshCache* cache):Device(device), MeshCache(cache)
 {
     Mesh = NULL;
 
@@ -45,10 +45,26 @@ IAnimatedMesh* CM2MeshFileLoader::createMesh(io::IReadFile* file)
     if(!file)
         return 0;
     MeshFile = file;
+    Dependencies.clear();
+
+    u8 digest[MESHCACHE_DIGEST_LENGTH];
+    bool useCache = MeshCache && MeshCache->getSourceDigest(file, digest);
+    if(useCache)
+    {
+        AnimatedMesh = MeshCache->load(digest);
+        if(AnimatedMesh)
+        {
+            AnimatedMesh->finalize();
+            return AnimatedMesh;
+        }
+    }
+
     AnimatedMesh = new scene::CM2Mesh();
 
     if ( load() )
     {
+        if(useCache)
+            MeshCache->save(digest, AnimatedMesh, Dependencies);
         AnimatedMesh->finalize();
     }
     else
@@ -396,6 +412,7 @@ void CM2MeshFileLoader::ReadAnimationData()
             c8 ext[13];
             sprintf(ext,"%04d-%02d.anim",tempAnimation.animationID,tempAnimation.subanimationID);
             AnimName = AnimName.substr(0, AnimName.length()-3) + ext;
+            Dependencies.push_back(AnimName.c_str());
             io::IReadFile* AnimFile = io::IrrCreateIReadFileBasic(Device, AnimName.c_str());
             if (!AnimFile)
             {
@@ -527,6 +544,7 @@ bool CM2MeshFileLoader::load()
 
       std::string SkinName = MeshFile->getFileName().c_str();
       SkinName = SkinName.substr(0, SkinName.length()-3) + "00.skin"; // FIX ME if we need more skins
+      Dependencies.push_back(SkinName.c_str());
       io::IReadFile* SkinFile = io::IrrCreateIReadFileBasic(Device, SkinName.c_str());
       if (!SkinFile)
       {
@@ -1,6 +1,7 @@
 #include "irrlicht/irrlicht.h"
 #include "irrlicht/IMeshLoader.h"
 #include "CM2Mesh.h"
+#include "CM2MeshCache.h"
 #include <string>
 #include <vector>
 #include <algorithm>
@@ -212,7 +213,8 @@ class CM2MeshFileLoader : public IMeshLoader
 public:
 
 	//! Constructor
-	CM2MeshFileLoader(IrrlichtDevice* device);
+	//! If a mesh cache is given, meshes are loaded from/stored to it
+	CM2MeshFileLoader(IrrlichtDevice* device, CM2MeshCache* cache = 0);
 
 	//! destructor
 	virtual ~CM2MeshFileLoader();
@@ -239,6 +241,8 @@ private:
     void ReadABlock(AnimBlock &ABlock, u8 datatype, u8 datanum);
 
 	IrrlichtDevice *Device;
+    CM2MeshCache *MeshCache;
+    core::array<core::stringc> Dependencies; // .skin/.anim files read for the current mesh, for the cache
     core::stringc Texdir;
     io::IReadFile *MeshFile, *SkinFile;
 
@@ -3,6 +3,7 @@
 #include "MemoryDataHolder.h"
 #include "MemoryInterface.h"
 #include "CWMOMeshFileLoader.h"
+#include "CMDHMemoryReadFile.h"
 #include "common.h"
 
 inline void flipcc(irr::u8 *fcc)
@@ -23,10 +24,20 @@ namespace irr
 namespace scene
 {
 
-CWMOMeshFileLoader::CWMOMeshFileLoader(IrrlichtDevice* device):Device(device)
+//! reads all elements of a chunk into arr with a single read
+template <class T> static void readChunkArray(io::IReadFile* file, core::array<T>& arr, u32 size)
 {
-    Mesh = NULL;
+    u32 count = size / sizeof(T);
+    arr.set_used(count);
+    if(count)
+        file->read((void*)arr.pointer(), count * sizeof(T));
+    if(size > count * sizeof(T))
+        file->seek(size - count * sizeof(T), true);
+}
 
+CWMOMeshFileLoader::CWMOMeshFileLoader(IrrlichtDevice* device, CM2MeshCache* cache):Device(device), MeshCache(cache)
+{
+    Mesh = NULL;
 }
 
 CWMOMeshFileLoader::~CWMOMeshFileLoader()
@@ -50,28 +61,69 @@ IAnimatedMesh* CWMOMeshFileLoader::createMesh(io::IReadFile* file)
         return 0;
     MeshFile = file;
     std::string filename=MeshFile->getFileName().c_str();
+
+    Dependencies.clear();
+    u8 digest[MESHCACHE_DIGEST_LENGTH];
+    bool useCache = MeshCache && MeshCache->getSourceDigest(file, digest);
+    if(useCache)
+    {
+        Mesh = MeshCache->load(digest);
+        if(Mesh)
+        {
+            Mesh->updateBoundingBox();
+            return Mesh;
+        }
+    }
+
     Mesh = new scene::CM2Mesh();
 
-	if ( load(true) )//We try loading a root file first!
+	if ( loadRoot() )//We try loading a root file first!
     {
-		for(u32 i=0;i<rootHeader.nGroups;i++)//On success, load all group files. This is getting slow as molasses for large files like Stormwind.wmo
+        //On success, load all group files. This is getting slow as molasses for large files like Stormwind.wmo,
+        //so they are fetched and parsed on the MemoryDataHolder loader threads, and only put into the mesh here.
+        core::array<WMOGroup*> groups;
+        groups.reallocate(rootHeader.nGroups);
+        for(u32 i=0;i<rootHeader.nGroups;i++)
         {
             char grpfilename[255];
             sprintf(grpfilename,"%s_%03u.wmo",filename.substr(0,filename.length()-4).c_str(),i);
             DEBUG(logdev("%s",grpfilename));
-            MeshFile = io::IrrCreateIReadFileBasic(Device,grpfilename);
-            if(!MeshFile)
+            WMOGroup *grp = new WMOGroup();
+            grp->Filename = grpfilename;
+            Dependencies.push_back(grpfilename);
+            groups.push_back(grp);
+        }
+        // all groups must be in the array before the first callback can run
+        for(u32 i=0;i<groups.size();i++)
+            MemoryDataHolder::GetFile(groups[i]->Filename.c_str(), true, &groupLoadedCallback, groups[i], NULL, false);
+
+        bool ok = true;
+        for(u32 i=0;i<groups.size();i++)//merge in group order, whichever finished first
+        {
+            while(!groups[i]->isDone())
+                Device->sleep(1);
+            if(!groups[i]->Ok)
             {
-                logerror("Could not read file %s!",grpfilename);
-                return 0;
+                logerror("Could not read file %s!",groups[i]->Filename.c_str());
+                ok = false;
             }
-            load(false);
+            else if(ok)
+                addGroup(*groups[i]);
+            delete groups[i];
+        }
+        if(!ok)
+        {
+            Mesh->drop();
+            Mesh = 0;
+            return 0;
         }
     Mesh->updateBoundingBox();
     Device->getSceneManager()->getMeshManipulator()->flipSurfaces(Mesh); //Fix inverted surfaces after the rotation
     //Does this crash on windows?
     Device->getSceneManager()->getMeshManipulator()->recalculateNormals(Mesh,true);//just to be sure
     DEBUG(logdev("Complete Mesh contains a total of %u submeshes!",Mesh->getMeshBufferCount()));
+    if(useCache)
+        MeshCache->save(digest, Mesh, Dependencies);
 	}
 	else
 	{
@@ -81,9 +133,8 @@ IAnimatedMesh* CWMOMeshFileLoader::createMesh(io::IReadFile* file)
 
 	return Mesh;
 }
-bool CWMOMeshFileLoader::load(bool _root)
+bool CWMOMeshFileLoader::loadRoot(void)
 {
-    bool isRootFile = _root;
     u8 _cc[5];
     u8 *fourcc = &_cc[0];
     fourcc[4]=0;
@@ -108,8 +159,6 @@ DEBUG(logdev("Reading Chunk: %s size %u", (char*)fourcc,size));
      else if(!strcmp((char*)fourcc,"MOHD")){
         MeshFile->read(&rootHeader,sizeof(RootHeader));
         DEBUG(logdev("Read Root Header: %u Textures, %u Groups, %u Models", rootHeader.nTextures, rootHeader.nGroups, rootHeader.nModels));
-        if(!isRootFile)//We should be reading a group file and found a root header, abort
-            return 0;
      }
      else if(!strcmp((char*)fourcc,"MOTX")){
         textureOffset=MeshFile->getPos();
@@ -119,12 +168,7 @@ DEBUG(logdev("Reading Chunk: %s size %u", (char*)fourcc,size));
         if(WMOMTexDefinition.size()>0)
             WMOMTexDefinition.clear();
 
-        MOMT_Data tempMOMT;
-        for(u32 i =0;i<(size/sizeof(MOMT_Data));i++)
-        {
-            MeshFile->read(&tempMOMT,sizeof(MOMT_Data));
-            WMOMTexDefinition.push_back(tempMOMT);
-        }
+        readChunkArray(MeshFile,WMOMTexDefinition,size);
         DEBUG(logdev("Read %u/%u TextureDefinitions",WMOMTexDefinition.size(),(size/sizeof(MOMT_Data))));
 
         u32 tempOffset = MeshFile->getPos();//Save current position for further reading until texture file names are read.
@@ -145,204 +189,201 @@ DEBUG(logdev("Reading Chunk: %s size %u", (char*)fourcc,size));
 
         MeshFile->seek(tempOffset);
      }
+     else if(!strcmp((char*)fourcc,"MOGP")){
+        //We should be reading a root file and found a Group header, abort
+        return 0;
+     }
 
+     else
+        MeshFile->seek(size,true);//Skip Chunk
+}
+return true;
+
+}
+
+void CWMOMeshFileLoader::groupLoadedCallback(void *ptr, std::string filename, uint32 flags)
+{
+    WMOGroup *grp = (WMOGroup*)ptr;
+    bool ok = false;
+    if(flags & MemoryDataHolder::MDH_FILE_OK)
+    {
+        // already in memory, this does not load it again
+        MemoryDataHolder::MemoryDataResult mdr = MemoryDataHolder::GetFileBasic(filename);
+        if(mdr.data.ptr)
+        {
+            io::IReadFile *file = new io::CMDHReadFile(mdr.data.ptr, mdr.data.size, filename.c_str());
+            ok = parseGroup(file, *grp);
+            file->drop();
+        }
+    }
+    grp->setDone(ok);
+}
+
+bool CWMOMeshFileLoader::parseGroup(io::IReadFile* file, WMOGroup& grp)
+{
+    u8 _cc[5];
+    u8 *fourcc = &_cc[0];
+    fourcc[4]=0;
+    u32 size;
+
+    core::array<u16> WMOMIndices;
+    core::array<core::vector3df> WMOMVertices;
+    core::array<core::vector3df> WMOMNormals;
+    core::array<core::vector2df> WMOMTexcoord;
+    core::array<MOPY_Data> WMOMTexData;
+    core::array<u16> submeshes;
+
+DEBUG(logdev("Trying to open file %s",file->getFileName().c_str()));
 
+while(file->getPos() < file->getSize())
+{
+file->read(fourcc,4);
+file->read(&size,4);
+flipcc(fourcc);
+DEBUG(logdev("Reading Chunk: %s size %u", (char*)fourcc,size));
 
-     //Start Group file parsing
+     if(!strcmp((char*)fourcc,"MOHD")){
+        //We should be reading a group file and found a root header, abort
+        return false;
+     }
      else if(!strcmp((char*)fourcc,"MOGP")){
         DEBUG(logdev("header okay: %s",(char*)fourcc));
-        MeshFile->seek(68,true);
-        if(isRootFile)//We should be reading a root file and found a Group header, abort
-            return 0;
+        file->seek(68,true);
      }
      else if(!strcmp((char*)fourcc,"MOPY")){//Texturing information (1 per triangle);
-        if(WMOMTexData.size()>0)
-            WMOMTexData.clear();
         submeshes.clear();//Saves last vertex of submes
         u16 previous_texid=999;//outside u8 space
-        MOPY_Data tempMOPY;
-        for(u32 i =0;i<(size/sizeof(MOPY_Data));i++)
+        readChunkArray(file,WMOMTexData,size);
+        for(u32 i =0;i<WMOMTexData.size();i++)
         {
-            MeshFile->read(&tempMOPY,sizeof(MOPY_Data));
             if(previous_texid==999)
-                previous_texid=tempMOPY.textureID;//Initialize
-            WMOMTexData.push_back(tempMOPY);
-            if(previous_texid!=tempMOPY.textureID)
+                previous_texid=WMOMTexData[i].textureID;//Initialize
+            if(previous_texid!=WMOMTexData[i].textureID)
                 submeshes.push_back(i);
-            previous_texid=tempMOPY.textureID;
+            previous_texid=WMOMTexData[i].textureID;
         }
+        if(WMOMTexData.size())
             submeshes.push_back(WMOMTexData.size()-1);//last read entry
         DEBUG(logdev("Read %u/%u Texture Informations, counted %u submeshes",WMOMTexData.size(),(size/sizeof(MOPY_Data)),submeshes.size()));
 
      }
      else if(!strcmp((char*)fourcc,"MOVI")){//Vertex indices (3 per triangle)
-        if(WMOMIndices.size()>0)
-            WMOMIndices.clear();
-
-        u16 tempWMOIndex;
-        for(u32 i =0;i<(size/sizeof(u16));i++)
-        {
-            MeshFile->read(&tempWMOIndex,sizeof(u16));
-            WMOMIndices.push_back(tempWMOIndex);
-        }
+        readChunkArray(file,WMOMIndices,size);
         DEBUG(logdev("Read %u/%u Indices",WMOMIndices.size(),(size/sizeof(u16))));
 
      }
      else if(!strcmp((char*)fourcc,"MOVT")){//Vertex coordinates
-        if(WMOMVertices.size()>0)
-            WMOMVertices.clear();
-
-        core::vector3df tempWMOVertex;
-        float tempYZ;
-        for(u32 i =0;i<(size/sizeof(core::vector3df));i++)
-        {
-            MeshFile->read(&tempWMOVertex,sizeof(core::vector3df));
-            tempYZ = tempWMOVertex.Y;
-            tempWMOVertex.Y=tempWMOVertex.Z;
-            tempWMOVertex.Z=tempYZ;
-            WMOMVertices.push_back(tempWMOVertex);
-        }
+        readChunkArray(file,WMOMVertices,size);
+        for(u32 i =0;i<WMOMVertices.size();i++)
+            core::swap(WMOMVertices[i].Y,WMOMVertices[i].Z);
         DEBUG(logdev("Read %u/%u Vertex Coordinates",WMOMVertices.size(),(size/sizeof(core::vector3df))));
 
      }
     else if(!strcmp((char*)fourcc,"MONR")){//Normals
-        if(WMOMNormals.size()>0)
-            WMOMNormals.clear();
-
-        core::vector3df tempWMONormal;
-        float tempYZ;
-        for(u32 i =0;i<(size/sizeof(core::vector3df));i++)
-        {
-            MeshFile->read(&tempWMONormal,sizeof(core::vector3df));
-            tempYZ = tempWMONormal.Y;
-            tempWMONormal.Y=tempWMONormal.Z;
-            tempWMONormal.Z=tempYZ;
-            WMOMNormals.push_back(tempWMONormal);
-        }
+        readChunkArray(file,WMOMNormals,size);
+        for(u32 i =0;i<WMOMNormals.size();i++)
+            core::swap(WMOMNormals[i].Y,WMOMNormals[i].Z);
         DEBUG(logdev("Read %u/%u Normal Coordinates",WMOMNormals.size(),(size/sizeof(core::vector3df))));
 
      }
     else if(!strcmp((char*)fourcc,"MOTV")){//TexCoord
-        if(WMOMTexcoord.size()>0)
-            WMOMTexcoord.clear();
-
-        core::vector2df tempWMOMTexcoord;
-        for(u32 i =0;i<(size/sizeof(core::vector2df));i++)
-        {
-            MeshFile->read(&tempWMOMTexcoord,sizeof(core::vector2df));
-            WMOMTexcoord.push_back(tempWMOMTexcoord);
-        }
+        readChunkArray(file,WMOMTexcoord,size);
         DEBUG(logdev("Read %u/%u Texture Coordinates",WMOMTexcoord.size(),(size/sizeof(core::vector2df))));
 
      }
-    else if(!strcmp((char*)fourcc,"MOCV")){//Vertex colors!! Scaaaary!
-        if(WMOMVertexColor.size()>0)
-            WMOMVertexColor.clear();
-
-        WMOColor tempWMOMVertexColor;
-
-        for(u32 i =0;i<(size/sizeof(WMOColor));i++)
-        {
-            MeshFile->read(&tempWMOMVertexColor,sizeof(WMOColor));
-            WMOMVertexColor.push_back(video::SColor(tempWMOMVertexColor.a,tempWMOMVertexColor.r,tempWMOMVertexColor.g,tempWMOMVertexColor.b));
-        }
-        DEBUG(logdev("Read %u/%u Vertex colors",WMOMVertexColor.size(),(size/sizeof(WMOColor))));
-
-     }
-     //End Group file parsing
-
+    //MOCV (vertex colors) is not used yet
 
      else
-        MeshFile->seek(size,true);//Skip Chunk
-}
-
-if(!isRootFile)//If we just read a group file, add a mesh buffer to the main Mesh
-{
-if(WMOVertices.size()>0)
-    WMOVertices.clear();
-
-for(u32 i=0;i<WMOMVertices.size();i++)
-{
-    //WMOMVertices, Normals and stuff are not usable like this. Thus we build Vertices in irrlicht format
-    //rotation happens when reading from file, so swapping Y and Z here is no longer necessary
-    WMOVertices.push_back(video::S3DVertex(WMOMVertices[i],WMOMNormals[i], video::SColor(255,100,100,100),WMOMTexcoord[i]));
+        file->seek(size,true);//Skip Chunk
 }
 
+//a vertex is only usable if the normal and texcoord for it were read as well
+u32 vertexCount = core::min_(WMOMVertices.size(), core::min_(WMOMNormals.size(), WMOMTexcoord.size()));
+//index of a group vertex in the batch being built, valid if its tag is the current one
+core::array<u16> VertexRemap;
+core::array<u32> VertexRemapTag;
+u32 RemapTag = 0;
+VertexRemap.set_used(vertexCount);
+VertexRemapTag.reallocate(vertexCount);
+for(u32 i=0;i<vertexCount;i++)
+    VertexRemapTag.push_back(0);
+
+grp.Batches.reallocate(submeshes.size());
 u32 lastindex=0;
 for(u32 i=0;i<submeshes.size();i++)//The mesh has to be split into submeshes because irrlicht only handles 1 texture per meshbuffer (not quite correct but i am to lazy to explain now)
     {
     if(WMOMTexData[lastindex].textureID!=255)
     {
-        scene::SSkinMeshBuffer *MeshBuffer = Mesh->addMeshBuffer(0);
-
-        //Put the Indices and Vertices of the Submesh into a mesh buffer
+        grp.Batches.push_back(WMOBatch());
+        WMOBatch& batch = grp.Batches.getLast();
+        batch.textureID = WMOMTexData[lastindex].textureID;
+
+        //Put the Indices of the Submesh into the batch, together with only the vertices they use.
+        //The indices are remapped to the order in which the vertices are first used.
+        RemapTag++;
+        batch.Indices.reallocate((submeshes[i]-lastindex)*3);
         for(u32 j=lastindex;j<submeshes[i];j++)
         {
             if((j*3+2)<WMOMIndices.size()&&WMOMTexData[j].textureID!=255)
                 {
-                MeshBuffer->Indices.push_back(WMOMIndices[j*3]);
-                MeshBuffer->Indices.push_back(WMOMIndices[j*3+1]);
-                MeshBuffer->Indices.push_back(WMOMIndices[j*3+2]);
+                const u16 *tri = &WMOMIndices[j*3];
+                if(tri[0]>=vertexCount || tri[1]>=vertexCount || tri[2]>=vertexCount)
+                    continue;
+                for(u32 k=0;k<3;k++)
+                {
+                    u16 v = tri[k];
+                    if(VertexRemapTag[v]!=RemapTag)
+                    {
+                        VertexRemapTag[v]=RemapTag;
+                        VertexRemap[v]=batch.Vertices.size();
+                        //rotation happens when reading from file, so swapping Y and Z here is no longer necessary
+                        batch.Vertices.push_back(video::S3DVertex(WMOMVertices[v],WMOMNormals[v], video::SColor(255,100,100,100),WMOMTexcoord[v]));
+                    }
+                    batch.Indices.push_back(VertexRemap[v]);
+                }
                 }
         }
-        DEBUG(logdev("Inserted %u Indices",MeshBuffer->Indices.size()));
+        DEBUG(logdev("Batch has %u Indices, %u Vertices",batch.Indices.size(),batch.Vertices.size()));
+    }
+    lastindex=submeshes[i];
+}
+return true;
+}
 
-        for(u32 j=0;j<WMOVertices.size();j++)
-        {
-            MeshBuffer->Vertices_Standard.push_back(WMOVertices[j]);
-        }
+//! puts the batches of a parsed group into mesh buffers. Texture loading needs the driver, so this runs on the caller's thread.
+void CWMOMeshFileLoader::addGroup(WMOGroup& grp)
+{
+for(u32 i=0;i<grp.Batches.size();i++)
+{
+        WMOBatch& batch = grp.Batches[i];
+        scene::SSkinMeshBuffer *MeshBuffer = Mesh->addMeshBuffer(0);
+        MeshBuffer->Indices.swap(batch.Indices);
+        MeshBuffer->Vertices_Standard.swap(batch.Vertices);
+        DEBUG(logdev("Inserted %u Indices, %u Vertices",MeshBuffer->Indices.size(),MeshBuffer->Vertices_Standard.size()));
 
-        DEBUG(logdev("Inserted %u Vertices",MeshBuffer->Vertices_Standard.size()));
-
-//         std::string TexName=Texdir.c_str();
-//         TexName+="/";
-//             TexName+=WMOMTextureFiles[WMOMTexData[lastindex].textureID].c_str();
-//         while(TexName.find('\\')<TexName.size())//Replace \ by /
-//             {
-//             TexName.replace(TexName.find('\\'),1,"/");
-//             }
-//         while(TexName.find(' ')<TexName.size())//Replace space by _
-//             {
-//             TexName.replace(TexName.find(' '),1,"_");
-//             }
-//         std::transform(TexName.begin(), TexName.end(), TexName.begin(), tolower);
-        char buf[1000];
-        MemoryDataHolder::MakeTextureFilename(buf,WMOMTextureFiles[WMOMTexData[lastindex].textureID].c_str());
-        video::ITexture* tex = Device->getVideoDriver()->findTexture(buf);
-        if(!tex)
+        if(batch.textureID<WMOMTextureFiles.size())
         {
-          io::IReadFile* TexFile = io::IrrCreateIReadFileBasic(Device, buf);
-//             logdebug("Texture %s loading",M2MTextureFiles[M2MTextureLookup[M2MTextureUnit[j].textureIndex]].c_str());
-          if (!TexFile)
-          {
-              logerror("CM2MeshFileLoader: Texture file not found: %s", buf);
-              continue;
-          }
-//             logdebug("Texture %s loaded",M2MTextureFiles[M2MTextureLookup[M2MTextureUnit[j].textureIndex]].c_str());
-        tex = Device->getVideoDriver()->getTexture(TexFile);
-        TexFile->drop();
+            char buf[1000];
+            MemoryDataHolder::MakeTextureFilename(buf,WMOMTextureFiles[batch.textureID].c_str());
+            video::ITexture* tex = Device->getVideoDriver()->findTexture(buf);
+            if(!tex)
+            {
+              io::IReadFile* TexFile = io::IrrCreateIReadFileBasic(Device, buf);
+              if (!TexFile)
+                  logerror("CWMOMeshFileLoader: Texture file not found: %s", buf);
+              else
+              {
+                  tex = Device->getVideoDriver()->getTexture(TexFile);
+                  TexFile->drop();
+              }
+            }
+            MeshBuffer->getMaterial().setTexture(0,tex);
+            if(WMOMTexDefinition[batch.textureID].blendMode==1)
+                MeshBuffer->getMaterial().MaterialType=video::EMT_TRANSPARENT_ALPHA_CHANNEL;
         }
-
-        MeshBuffer->getMaterial().setTexture(0,tex);
-        if(WMOMTexDefinition[WMOMTexData[lastindex].textureID].blendMode==1)
-            MeshBuffer->getMaterial().MaterialType=video::EMT_TRANSPARENT_ALPHA_CHANNEL;
         MeshBuffer->recalculateBoundingBox();
         MeshBuffer->setHardwareMappingHint(EHM_STATIC);
-    }
-    lastindex=submeshes[i];
-
-}
-
-WMOMIndices.clear();
-WMOMVertices.clear();
-WMOMNormals.clear();
-WMOMTexcoord.clear();
-WMOMVertexColor.clear();
-
-WMOVertices.clear();
 }
-return true;
-
 }
 
 }
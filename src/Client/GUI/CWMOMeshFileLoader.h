@@ -1,6 +1,10 @@
 #include "irrlicht/irrlicht.h"
 #include "irrlicht/IMeshLoader.h"
 #include "CM2Mesh.h"
+#include "CM2MeshCache.h"
+#include "common.h"
+#include "zthread/FastMutex.h"
+#include "zthread/Guard.h"
 #include <string>
 #include <vector>
 #include <algorithm>
@@ -35,6 +39,30 @@ struct MOPY_Data{
     u8 flags,textureID;
 
 };
+//! one texture batch of a WMO group, with only the vertices its indices use
+struct WMOBatch
+{
+    u8 textureID;
+    core::array<u16> Indices;
+    core::array<video::S3DVertex> Vertices;
+};
+
+//! a WMO group file, parsed on a MemoryDataHolder loader thread and put into the mesh by the loader afterwards
+struct WMOGroup
+{
+    WMOGroup() : Ok(false), Done(false) {}
+    bool isDone(void) { ZThread::Guard<ZThread::FastMutex> g(Mutex); return Done; }
+    void setDone(bool ok) { ZThread::Guard<ZThread::FastMutex> g(Mutex); Ok = ok; Done = true; }
+
+    core::stringc Filename;
+    core::array<WMOBatch> Batches;
+    bool Ok;
+
+private:
+    bool Done;
+    ZThread::FastMutex Mutex;
+};
+
 struct MOMT_Data{
 /*000h*/  u32 flags1;
 /*004h*/  u32 flags2;
@@ -61,7 +89,8 @@ class CWMOMeshFileLoader : public IMeshLoader
 public:
 
 	//! Constructor
-	CWMOMeshFileLoader(IrrlichtDevice* device);
+	//! If a mesh cache is given, meshes are loaded from/stored to it
+	CWMOMeshFileLoader(IrrlichtDevice* device, CM2MeshCache* cache = 0);
 
 	//! destructor
 	virtual ~CWMOMeshFileLoader();
@@ -77,9 +106,14 @@ public:
 	virtual scene::IAnimatedMesh* createMesh(io::IReadFile* file);
 private:
 
-	bool load(bool _root);
+	bool loadRoot(void);
+	void addGroup(WMOGroup& grp);
+	static bool parseGroup(io::IReadFile* file, WMOGroup& grp);
+	static void groupLoadedCallback(void *ptr, std::string filename, uint32 flags);
 
 	IrrlichtDevice* Device;
+    CM2MeshCache* MeshCache;
+    core::array<core::stringc> Dependencies; // group files read for the current mesh, for the cache
     core::stringc Texdir;
     io::IReadFile* MeshFile;
 
@@ -92,17 +126,7 @@ private:
     core::array<std::string> WMOMTextureFiles;
 
 
-//Stuff from group file
-    core::array<u16> WMOMIndices;
-    core::array<core::vector3df> WMOMVertices;
-    core::array<core::vector3df> WMOMNormals;
-    core::array<core::vector2df> WMOMTexcoord;
-    core::array<video::SColor> WMOMVertexColor;
-    core::array<MOPY_Data> WMOMTexData;
-    core::array<u16> submeshes;
 
-    core::array<video::S3DVertex> WMOVertices;
-    SSkinMeshBuffer* MeshBuffer;
 /*
     ModelHeader header;
     core::stringc WMOMeshName;
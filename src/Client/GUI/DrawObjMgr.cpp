@@ -31,6 +31,11 @@ void DrawObjMgr::Clear(void)
     {
         _del.next();
     }
+    while(_templ.size())
+    {
+        _templ.next();
+    }
+    _parked.clear();
 }
 
 void DrawObjMgr::Add(uint64 objguid, DrawObject *o)
@@ -43,6 +48,11 @@ void DrawObjMgr::Delete(uint64 guid)
     _del.add(guid);
 }
 
+void DrawObjMgr::GOTemplateArrived(uint32 entry)
+{
+    _templ.add(entry);
+}
+
 void DrawObjMgr::UnlinkAll(void)
 {
     DEBUG( logdebug("DrawObjMgr::UnlinkAll(), %u DrawObjects...", _storage.size() ) );
@@ -78,6 +88,19 @@ void DrawObjMgr::Update(void)
 
             DrawObject *o = _storage[guid];
             DEBUG(logdebug("DrawObjMgr: removing DrawObj 0x%X guid "I64FMT" from main storage",o,guid));
+            if(o->IsParked())
+            {
+                std::multimap<uint32,uint64>::iterator first = _parked.lower_bound(o->GetParkedEntry());
+                std::multimap<uint32,uint64>::iterator last = _parked.upper_bound(o->GetParkedEntry());
+                for(std::multimap<uint32,uint64>::iterator p = first; p != last; p++)
+                {
+                    if(p->second == guid)
+                    {
+                        _parked.erase(p);
+                        break;
+                    }
+                }
+            }
             _storage.erase(guid);
             delete o;
         }
@@ -87,10 +110,32 @@ void DrawObjMgr::Update(void)
         }
     }
 
-    // now draw everything
+    // now draw everything. objects that can't be initialized yet park themselves instead of waiting,
+    // and are skipped until what they need is there.
     for(DrawObjStorage::iterator i = _storage.begin(); i != _storage.end(); i++)
     {
-        i->second->Draw();
+        DrawObject *o = i->second;
+        if(o->IsParked())
+            continue;
+        o->Draw();
+        if(o->IsParked())
+            _parked.insert(std::pair<uint32,uint64>(o->GetParkedEntry(), i->first));
+    }
+
+    // wake up the objects whose template arrived. done after drawing, so that a template arriving
+    // between an object's failed lookup and its parking above still reaches it, in the next frame at the latest.
+    while(_templ.size())
+    {
+        uint32 entry = _templ.next();
+        std::multimap<uint32,uint64>::iterator first = _parked.lower_bound(entry);
+        std::multimap<uint32,uint64>::iterator last = _parked.upper_bound(entry);
+        for(std::multimap<uint32,uint64>::iterator p = first; p != last; p++)
+        {
+            DrawObjStorage::iterator it = _storage.find(p->second);
+            if(it != _storage.end()) // might have been deleted in the meantime
+                it->second->Unpark();
+        }
+        _parked.erase(first, last);
     }
 
     //mut.release();
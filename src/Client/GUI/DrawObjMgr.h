@@ -16,6 +16,7 @@ public:
     void Delete(uint64);
     void Clear(void);
     void Update(void); // Threadsafe! delete code must be called from here!
+    void GOTemplateArrived(uint32 entry); // wakes up the DrawObjects parked until this template is known
     uint32 StorageSize(void) { return _storage.size(); }
     void UnlinkAll(void);
     DrawObject *Get(uint64);
@@ -24,6 +25,8 @@ private:
     DrawObjStorage _storage;
     ZThread::LockedQueue<uint64,ZThread::FastMutex> _del;
     ZThread::LockedQueue<std::pair<uint64,DrawObject*>,ZThread::FastMutex > _add;
+    ZThread::LockedQueue<uint32,ZThread::FastMutex> _templ; // GO templates that arrived since the last Update()
+    std::multimap<uint32,uint64> _parked; // GO template entry -> guids of the DrawObjects waiting for it
 
 };
 
@@ -8,12 +8,46 @@
 #include "World/WorldSession.h"
 #include "MemoryInterface.h"
 #include "MemoryDataHolder.h"
+#include "CM2Mesh.h"
 
 using namespace irr;
 
+// databases and columns needed to find the models of objects. resolved once,
+// and again only after the databases changed, so _Init() needs no string lookups.
+struct DrawObjectDBs
+{
+    DrawObjectDBs() : mgr(NULL), generation(0) {}
+    void Resolve(SCPDatabaseMgr& dbmgr)
+    {
+        if(mgr == &dbmgr && generation == dbmgr.GetGeneration())
+            return;
+        mgr = &dbmgr;
+        generation = dbmgr.GetGeneration();
+        cdi = dbmgr.GetDB("creaturedisplayinfo");
+        cmd = dbmgr.GetDB("creaturemodeldata");
+        gdi = dbmgr.GetDB("gameobjectdisplayinfo");
+        cdi_model = cdi ? cdi->GetColumn("model") : SCPColumn();
+        cdi_opacity = cdi ? cdi->GetColumn("opacity") : SCPColumn();
+        cmd_file = cmd ? cmd->GetColumn("mpqfilename") : SCPColumn();
+        gdi_file = gdi ? gdi->GetColumn("mpqfilename") : SCPColumn();
+        gdi_texture = gdi ? gdi->GetColumn("texture") : SCPColumn();
+    }
+
+    SCPDatabaseMgr *mgr;
+    uint32 generation;
+    SCPDatabase *cdi, *cmd, *gdi;
+    SCPColumn cdi_model, cdi_opacity, cmd_file, gdi_file, gdi_texture;
+};
+
+static DrawObjectDBs dodbs; // only used by the GUI thread
+
 DrawObject::DrawObject(irr::IrrlichtDevice *device, Object *obj, PseuInstance *ins)
 {
     _initialized = false;
+    _parkedentry = 0;
+    _placed = false;
+    _labeled = false;
+    _lastscale = 0;
     Unlink();
     _device = device;
     _smgr = device->getSceneManager();
@@ -55,23 +89,24 @@ void DrawObject::_Init(void)
         if (_obj->IsUnit())
         {
             uint32 displayid = _obj->GetUInt32Value(UNIT_FIELD_DISPLAYID);
-            SCPDatabase *cdi = _instance->dbmgr.GetDB("creaturedisplayinfo");
-            SCPDatabase *cmd = _instance->dbmgr.GetDB("creaturemodeldata");
+            dodbs.Resolve(_instance->dbmgr);
+            SCPDatabase *cdi = dodbs.cdi;
+            SCPDatabase *cmd = dodbs.cmd;
 			if(cdi == NULL || cmd == NULL)
 			{
 			  logerror("DrawObject: Could not open SCP Database");
 			  return;
 			}
-            uint32 modelid = cdi && displayid ? cdi->GetUint32(displayid,"model") : 0;
+            uint32 modelid = cdi && displayid ? cdi->GetUint32(displayid,dodbs.cdi_model) : 0;
             logdebug("modelid = %u, displayid = %u",modelid,displayid);
 //             modelfilename = std::string("data/model/") + (cmd ? cmd->GetString(modelid,"file") : "");
             char buf[1000];
-            MemoryDataHolder::MakeModelFilename(buf,(cmd ? cmd->GetString(modelid,"mpqfilename") : ""));
+            MemoryDataHolder::MakeModelFilename(buf,(cmd ? cmd->GetString(modelid,dodbs.cmd_file) : ""));
             modelfilename = buf;
-            logdebug("Unit %s",cmd->GetString(modelid,"mpqfilename"));
+            logdebug("Unit %s",cmd->GetString(modelid,dodbs.cmd_file));
 //             if (cdi && strcmp(cdi->GetString(displayid,"name1"), "") != 0)
 //                 texturename = std::string("data/texture/") + cdi->GetString(displayid,"name1");
-            opacity = cdi && displayid ? cdi->GetUint32(displayid,"opacity") : 255;
+            opacity = cdi && displayid ? cdi->GetUint32(displayid,dodbs.cdi_opacity) : 255;
         }
         else if (_obj->IsCorpse())
         {
@@ -97,10 +132,12 @@ void DrawObject::_Init(void)
         else if (_obj->IsGameObject())
         {
             GameobjectTemplate* gotempl = _instance->GetWSession()->objmgr.GetGOTemplate(_obj->GetEntry());
-            while (!gotempl)
+            if (!gotempl && _obj->GetEntry())
             {
-                ZThread::Thread::sleep(10);
-                gotempl = _instance->GetWSession()->objmgr.GetGOTemplate(_obj->GetEntry());
+                // query still outstanding, try again as soon as the template arrived
+                _parkedentry = _obj->GetEntry();
+                DEBUG(logdebug("DrawObject 0x%X: waiting for GO template %u",this,_parkedentry));
+                return;
             }
             if (gotempl)
             {
@@ -112,18 +149,19 @@ void DrawObject::_Init(void)
                 }
 
                 uint32 displayid = gotempl->displayId;
-                SCPDatabase *gdi = _instance->dbmgr.GetDB("gameobjectdisplayinfo");
+                dodbs.Resolve(_instance->dbmgr);
+                SCPDatabase *gdi = dodbs.gdi;
                 if (gdi && displayid)
                 {
                     char buf[1000];
-                    MemoryDataHolder::MakeModelFilename(buf,gdi->GetString(displayid,"mpqfilename"));
+                    MemoryDataHolder::MakeModelFilename(buf,gdi->GetString(displayid,dodbs.gdi_file));
                     modelfilename = buf;
                     logdebug("Gameobject %s",buf);
 
-                    if (strcmp(gdi->GetString(displayid,"texture"), "") != 0)
+                    if (strcmp(gdi->GetString(displayid,dodbs.gdi_texture), "") != 0)
                     {
                         char buf[1000];
-                        MemoryDataHolder::MakeTextureFilename(buf,gdi->GetString(displayid,"texture"));
+                        MemoryDataHolder::MakeTextureFilename(buf,gdi->GetString(displayid,dodbs.gdi_texture));
                         texturename = buf;
                     }
                 }
@@ -134,12 +172,20 @@ void DrawObject::_Init(void)
             }
         }
 
-        io::IReadFile* modelfile = io::IrrCreateIReadFileBasic(_device, modelfilename.c_str());
-        if (!modelfile)
-            {
-                logerror("DrawObject: model file not found: %s", modelfilename.c_str());
-            }
-        scene::IAnimatedMesh *mesh = _smgr->getMesh(modelfile);
+        // objects with the same display id share one mesh (and its skinned frames, see CM2Mesh::getMesh()),
+        // only the first of them has to read the model file
+        scene::IAnimatedMesh *mesh = _smgr->getMeshCache()->getMeshByName(modelfilename.c_str());
+        if (!mesh)
+        {
+            io::IReadFile* modelfile = io::IrrCreateIReadFileBasic(_device, modelfilename.c_str());
+            if (!modelfile)
+                {
+                    logerror("DrawObject: model file not found: %s", modelfilename.c_str());
+                }
+            mesh = _smgr->getMesh(modelfile);
+            if (modelfile)
+                modelfile->drop();
+        }
 
 
         if(mesh)
@@ -148,6 +194,18 @@ void DrawObject::_Init(void)
             scene::IAnimatedMeshSceneNode* aninode = (scene::IAnimatedMeshSceneNode*)node;
 
             aninode->setAnimationSpeed(1000);
+            if(mesh->getMeshType() == scene::EAMT_M2)
+            {
+                // the meshes of objects are drawn by many nodes. each node keeps its own animation phase, unless
+                // SharedAnimation makes them play in step at a fixed frame rate, so that they share skinned frames.
+                scene::CM2Mesh *m2 = (scene::CM2Mesh*)mesh;
+                m2->setPoseCache(true);
+                if(_instance->GetConf()->sharedanimation)
+                {
+                    m2->setPoseFrameStep(scene::M2MESH_POSE_FRAME_STEP);
+                    aninode->setM2GlobalClock(true);
+                }
+            }
             aninode->setM2Animation(0);
             //video::ITexture *tex = _device->getVideoDriver()->getTexture("data/misc/square.jpg");
             //node->setMaterialTexture(0, tex);
@@ -199,29 +257,59 @@ void DrawObject::Draw(void)
     //printf("DRAW() for pObj 0x%X name '%s' guid "I64FMT"\n", _obj, _obj->GetName().c_str(), _obj->GetGUID());
     if(node)
     {
-        WorldPosition pos = ((WorldObject*)_obj)->GetPosition();
-        node->setPosition(WPToIrr(pos));
-        rotation.Y = O_TO_IRR(pos.o);
-        float s = _obj->GetFloatValue(OBJECT_FIELD_SCALE_X);
-        if(s <= 0)
-            s = 1;
-        node->setScale(irr::core::vector3df(s,s,s));
-        node->setRotation(rotation);
-
-        //node->setRotation(irr::core::vector3df(0,RAD_TO_DEG(((WorldObject*)_obj)->GetO()),0));
-        irr::core::stringw tmp = L"";
-        if(_obj->GetName().empty() && !_obj->IsCorpse())
-        {
-            tmp += L"unk<";
-            tmp += _obj->GetTypeId();
-            tmp += L">";
-        }
-        else
-        {
-            tmp += _obj->GetName().c_str();
-        }
-        text->setText(tmp.c_str());
+        _UpdateTransform();
+        _UpdateLabel();
+    }
+}
+
+void DrawObject::_UpdateTransform(void)
+{
+    WorldPosition pos = ((WorldObject*)_obj)->GetPosition();
+    float s = _obj->GetFloatValue(OBJECT_FIELD_SCALE_X);
+    if(s <= 0)
+        s = 1;
+
+    if(_placed && pos.x == _lastpos.x && pos.y == _lastpos.y && pos.z == _lastpos.z && pos.o == _lastpos.o && s == _lastscale)
+        return;
+
+    node->setPosition(WPToIrr(pos));
+    rotation.Y = O_TO_IRR(pos.o);
+    node->setScale(irr::core::vector3df(s,s,s));
+    node->setRotation(rotation);
+    //node->setRotation(irr::core::vector3df(0,RAD_TO_DEG(((WorldObject*)_obj)->GetO()),0));
 
+    _lastpos = pos;
+    _lastscale = s;
+    _placed = true;
+}
+
+void DrawObject::_UpdateLabel(void)
+{
+    irr::scene::ICameraSceneNode *cam = _smgr->getActiveCamera();
+    bool inrange = !cam || cam->getAbsolutePosition().getDistanceFromSQ(node->getPosition()) <= DRAWOBJECT_LABEL_DISTANCE * DRAWOBJECT_LABEL_DISTANCE;
+    if(text->isVisible() != inrange)
+        text->setVisible(inrange);
+    if(!inrange)
+        return;
+
+    const std::string& name = _obj->GetName();
+    if(_labeled && name == _lastname)
+        return;
+
+    irr::core::stringw tmp = L"";
+    if(name.empty() && !_obj->IsCorpse())
+    {
+        tmp += L"unk<";
+        tmp += _obj->GetTypeId();
+        tmp += L">";
+    }
+    else
+    {
+        tmp += name.c_str();
     }
+    text->setText(tmp.c_str());
+
+    _lastname = name;
+    _labeled = true;
 }
 
@@ -3,6 +3,9 @@
 
 #include "common.h"
 #include "irrlicht/irrlicht.h"
+#include "World/World.h"
+
+#define DRAWOBJECT_LABEL_DISTANCE 100.0f // name labels of objects farther away from the camera are hidden
 
 class Object;
 class PseuInstance;
@@ -15,12 +18,19 @@ public:
     void Draw(void); // call only in threadsafe environment!! (ensure the obj ptr is still valid!)
     void Unlink(void);
     inline irr::scene::ISceneNode *GetSceneNode(void) { return node; }
+    // a parked object waits for the template of a game object, Draw() does nothing until Unpark() is called
+    inline bool IsParked(void) { return _parkedentry != 0; }
+    inline uint32 GetParkedEntry(void) { return _parkedentry; }
+    inline void Unpark(void) { _parkedentry = 0; }
     // additionally, we dont use a GetObject() func - that would fuck things up if the object was already deleted.
 
 private:
     void _Init(void);
+    void _UpdateTransform(void);
+    void _UpdateLabel(void);
     Object *_obj;
     bool _initialized : 1;
+    uint32 _parkedentry;
     irr::IrrlichtDevice *_device;
     irr::scene::ISceneManager *_smgr;
     irr::gui::IGUIEnvironment* _guienv;
@@ -29,6 +39,13 @@ private:
     PseuInstance *_instance;
     irr::core::vector3df rotation;
 
+    // what the scene node shows right now, to touch it only when something changed
+    bool _placed : 1;
+    bool _labeled : 1;
+    WorldPosition _lastpos;
+    float _lastscale;
+    std::string _lastname;
+
 };
 
 #endif
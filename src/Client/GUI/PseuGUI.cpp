@@ -46,6 +46,7 @@ PseuGUI::PseuGUI()
     _scene = NULL;
     _passtime = _lastpasstime = _passtimediff = 0;
     _soundengine = NULL;
+    _meshcache = NULL;
     _usesound = false;
 }
 
@@ -128,9 +129,11 @@ void PseuGUI::_Init(void)
     _device->getLogger()->setLogLevel(ELL_NONE);
 
     // register external loaders for not supported filetypes
-    scene::CM2MeshFileLoader* m2loader = new scene::CM2MeshFileLoader(_device);
+    if(GetInstance()->GetConf()->meshcache)
+        _meshcache = new scene::CM2MeshCache(_device, "./cache/models");
+    scene::CM2MeshFileLoader* m2loader = new scene::CM2MeshFileLoader(_device, _meshcache);
     _smgr->addExternalMeshLoader(m2loader);
-    scene::CWMOMeshFileLoader* wmoloader = new scene::CWMOMeshFileLoader(_device);
+    scene::CWMOMeshFileLoader* wmoloader = new scene::CWMOMeshFileLoader(_device, _meshcache);
     _smgr->addExternalMeshLoader(wmoloader);
     _throttle=0;
     _initialized = true;
@@ -168,6 +171,11 @@ void PseuGUI::Cancel(void)
         _device->drop();
         _device = NULL;
     }
+    if(_meshcache)
+    {
+        delete _meshcache;
+        _meshcache = NULL;
+    }
     if(_soundengine)
     {
         _soundengine->drop();
@@ -282,6 +290,12 @@ void PseuGUI::NotifyAllObjectsDeletion(void)
     domgr.Clear();
 }
 
+// called from ObjMgr::Add(GameobjectTemplate*)
+void PseuGUI::NotifyGOTemplateArrival(uint32 entry)
+{
+    domgr.GOTemplateArrived(entry);
+}
+
 void PseuGUI::SetInstance(PseuInstance* in)
 {
     _instance = in;
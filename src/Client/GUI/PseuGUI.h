@@ -12,6 +12,14 @@ class Object;
 class PseuInstance;
 class Scene;
 
+namespace irr
+{
+    namespace scene
+    {
+        class CM2MeshCache;
+    }
+}
+
 enum SceneState
 {
     SCENESTATE_NULL = 0,
@@ -99,6 +107,7 @@ public:
     void NotifyObjectDeletion(uint64 guid);
     void NotifyObjectCreation(Object *o);
     void NotifyAllObjectsDeletion(void);
+    void NotifyGOTemplateArrival(uint32 entry);
 
     // scenes
     void SetSceneState(SceneState);
@@ -122,6 +131,7 @@ private:
     irr::gui::IGUIEnvironment* _guienv;
     irr::video::E_DRIVER_TYPE _driverType;
     irrklang::ISoundEngine *_soundengine;
+    irr::scene::CM2MeshCache *_meshcache;
     DrawObjMgr domgr;
     PseuInstance *_instance;
     SceneState _scenestate, _scenestate_new;
@@ -593,6 +593,7 @@ void SceneWorld::UpdateTerrain(void)
     terrain->setPosition(tpos);
 
     logdebug("SceneWorld: Displaying MapTiles near grids x:%u y:%u",mapmgr->GetGridX(),mapmgr->GetGridY());
+    bool hasnormals = true;
     logdebug("Loaded maps: %u: %s",mapmgr->GetLoadedMapsCount(), mapmgr->GetLoadedTilesString().c_str());
     for(s32 tiley = 0; tiley < 3; tiley++)
     {
@@ -610,6 +611,9 @@ void SceneWorld::UpdateTerrain(void)
                     for(uint32 chx = 0; chx < 16; chx++)
                     {
                         MapChunk *chunk = maptile->GetChunk(chx, chy);
+                        MapChunkDetail *detail = maptile->GetChunkDetail(chx, chy); // loaded from the ADT on first use
+                        if(!detail)
+                            hasnormals = false;
                         for(uint32 hy = 0; hy < 8; hy++)
                         {
                             for(uint32 hx = 0; hx < 8; hx++)
@@ -618,6 +622,13 @@ void SceneWorld::UpdateTerrain(void)
                                 u32 terrainx = (128 * tilex) + (8 * chx) + hx;
                                 u32 terrainy = (128 * tiley) + (8 * chy) + hy;
                                 terrain->setHeight(terrainy, terrainx, h);
+                                if(detail)
+                                {
+                                    // rough and fine vertices are interleaved in rows of 9 + 8, values are signed, 127 == 1.0
+                                    NormalVector& n = detail->normals[hy * 17 + hx];
+                                    vector3df normal(-(f32)(int8)n.x, (f32)(int8)n.z, -(f32)(int8)n.y);
+                                    terrain->setNormal(terrainy, terrainx, normal.normalize());
+                                }
                             }
                         }
                     }
@@ -822,6 +833,7 @@ void SceneWorld::UpdateTerrain(void)
             else
             {
                 logerror("SceneWorld: MapTile (%u, %u) not loaded!", tile_real_x, tile_real_y);
+                hasnormals = false;
             }
         }
     }
@@ -852,8 +864,12 @@ void SceneWorld::UpdateTerrain(void)
             terrain->setColor(i,j, video::SColor(255,r,g,b));
         }
 
-    logdebug("SceneWorld: Smoothing terrain normals...");
-    terrain->smoothNormals();
+    // the normals stored in the ADTs are used if all tiles had them
+    if(!hasnormals)
+    {
+        logdebug("SceneWorld: Smoothing terrain normals...");
+        terrain->smoothNormals();
+    }
 
     // TODO: check if camera should really be relocated -> in case we got teleported
     // do NOT relocate camera if we moved around and triggered the map loading code by ourself!
@@ -570,6 +570,8 @@ void PseuInstanceConf::ApplyFromVarSet(VarSet &v)
     fogfar = atof(v.Get("GUI::FOGFAR").c_str());
     fognear = atof(v.Get("GUI::FOGNEAR").c_str());
     fov = atof(v.Get("GUI::FOV").c_str());
+    meshcache = (bool)atoi(v.Get("GUI::MESHCACHE").c_str());
+    sharedanimation = (bool)atoi(v.Get("GUI::SHAREDANIMATION").c_str());
     masterSoundVolume = atof(v.Get("GUI::MASTERSOUNDVOLUME").c_str());
 
     // cleanups, internal settings, etc.
@@ -91,6 +91,8 @@ class PseuInstanceConf
     float fogfar;
     float fognear;
     float fov;
+    bool meshcache;
+    bool sharedanimation;
 
     // sound related
     float masterSoundVolume;
@@ -123,6 +125,7 @@ public:
     inline BigNumber *GetSessionKey(void) { return &_sessionkey; }
     inline void SetError(void) { _error = true; }
     SCPDatabaseMgr dbmgr;
+    SCPValueLookup scpvalue; // state of the getscpvalue script command
 
     bool Init(void);
     bool InitGUI(void);
@@ -134,8 +134,10 @@ void RealmSession::Connect(void)
     ClearSocket();
     _socket = new RealmSocket(_sh);
     _socket->SetSession(this);
+    _sh.EnableResolver(); // don't block on DNS, the name is looked up by the shared resolver thread
     _socket->Open(GetInstance()->GetConf()->realmlist,GetInstance()->GetConf()->realmport);
-    _sh.Add(_socket);
+    if(_socket->GetSocket() != INVALID_SOCKET) // else it is still being resolved and adds itself when done
+        _sh.Add(_socket);
     _sh.Select(3,0);
 }
 
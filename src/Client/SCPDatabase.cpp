@@ -44,6 +44,7 @@ void SCPDatabase::DropAll(void)
         delete [] _intbuf;
     _indexes.clear();
     _indexes_reverse.clear();
+    _rowlookup.clear();
     _fielddefs.clear();
     _stringbuf = NULL;
     _intbuf = NULL;
@@ -62,28 +63,45 @@ void SCPDatabase::DropTextData(void)
 
 void *SCPDatabase::GetPtr(uint32 index, const char *entry)
 {
-    std::map<uint32,uint32>::iterator it = _indexes.find(index);
-    if(it == _indexes.end())
+    uint32 target_row = GetRow(index);
+    if(target_row == SCP_INVALID_INT)
         return NULL;
     std::map<std::string,SCPFieldDef>::iterator fi = _fielddefs.find(entry);
     if(fi == _fielddefs.end())
         return NULL;
 
-    uint32 target_row = _indexes[index];
-    uint32 field_id = _fielddefs[entry].id;
-    return (void*)&_intbuf[(_fields_per_row * target_row) + field_id];
+    return (void*)&_intbuf[(_fields_per_row * target_row) + fi->second.id];
 }
 
 void *SCPDatabase::GetPtrByField(uint32 index, uint32 entry)
 {
-    std::map<uint32,uint32>::iterator it = _indexes.find(index);
-    if(it == _indexes.end())
+    uint32 target_row = GetRow(index);
+    if(target_row == SCP_INVALID_INT)
         return NULL;
 
-    uint32 target_row = _indexes[index];
     return (void*)&_intbuf[(_fields_per_row * target_row) + entry];
 }
 
+uint32 SCPDatabase::_GetRowFromMap(uint32 index)
+{
+    std::map<uint32,uint32>::iterator it = _indexes.find(index);
+    return it != _indexes.end() ? it->second : SCP_INVALID_INT;
+}
+
+// called after loading. most databases have (nearly) contiguous indexes, so a plain array is affordable.
+void SCPDatabase::_BuildRowLookup(void)
+{
+    _rowlookup.clear();
+    if(_indexes.empty())
+        return;
+    uint32 maxindex = _indexes.rbegin()->first;
+    if(maxindex > 4 * _indexes.size() + 1024)
+        return; // too sparse, keep using the map
+    _rowlookup.assign(maxindex + 1, SCP_INVALID_INT);
+    for(std::map<uint32,uint32>::iterator it = _indexes.begin(); it != _indexes.end(); it++)
+        _rowlookup[it->first] = it->second;
+}
+
 uint32 SCPDatabase::GetFieldByUint32Value(const char *entry, uint32 val)
 {
     std::map<std::string,SCPFieldDef>::iterator fi = _fielddefs.find(entry);
@@ -154,9 +172,26 @@ uint32 SCPDatabase::GetFieldId(const char *entry)
     return SCP_INVALID_INT;
 }
 
+SCPColumn SCPDatabase::GetColumn(const char *entry)
+{
+    SCPColumn col;
+    std::map<std::string,SCPFieldDef>::iterator it = _fielddefs.find(entry);
+    if(it != _fielddefs.end())
+    {
+        col.id = it->second.id;
+        col.type = it->second.type;
+    }
+    return col;
+}
+
 SCPDatabase *SCPDatabaseMgr::GetDB(std::string n, bool create)
 {
-    return create ? _map.Get(n) : _map.GetNoCreate(n);
+    if(create)
+    {
+        _generation++;
+        return _map.Get(n);
+    }
+    return _map.GetNoCreate(n);
 }
 
 uint32 SCPDatabaseMgr::AutoLoadFile(const char *fn)
@@ -513,6 +548,8 @@ bool SCPDatabaseMgr::Compact(const char *dbname, const char *outfile, uint32 com
     db->_fielddefs = fieldIdMap;
     for(std::map<uint32,uint32>::iterator it = idToSectionMap.begin(); it != idToSectionMap.end(); it++)
         db->_indexes_reverse[it->second] = it->first;
+    db->_BuildRowLookup();
+    _generation++;
 
     return true;
 }
@@ -902,6 +939,8 @@ bool SCPDatabaseMgr::LoadCompactSCP(const char *fn, const char *dbname, uint32 n
     db->_stringsize = sizeStrings;
     db->_rowcount = nRows;
     db->_fields_per_row = nFields;
+    db->_BuildRowLookup();
+    _generation++;
 
     db->DropTextData(); // delete pointers to file content created at md5 comparison
 
@@ -4,6 +4,7 @@
 #include "TypeStorage.h"
 #include "ZCompressor.h"
 #include <set>
+#include <vector>
 
 enum SCPFieldTypes
 {
@@ -25,6 +26,17 @@ struct SCPFieldDef
 
 #define SCP_INVALID_INT 0xFFFFFFFF
 
+// a column of a database, resolved once by name with SCPDatabase::GetColumn().
+// reading values through it needs no string lookups at all.
+// stays valid until the database is reloaded, see SCPDatabaseMgr::GetGeneration().
+struct SCPColumn
+{
+    SCPColumn() : id(SCP_INVALID_INT), type(SCP_TYPE_INT) {}
+    inline bool IsValid(void) const { return id != SCP_INVALID_INT; }
+    uint32 id;
+    uint8 type;
+};
+
 typedef std::map<std::string,std::string> SCPEntryMap;
 typedef std::map<uint32,SCPEntryMap> SCPFieldMap;
 typedef std::set<std::string> SCPSourceList;
@@ -58,6 +70,25 @@ public:
     inline float GetFloat(uint32 index, uint32 entry) { float *t = (float*)GetPtrByField(index,entry); return t ? *t : 0; }
     uint32 GetFieldType(const char *entry);
     uint32 GetFieldId(const char *entry);
+
+    // access funcs using pre-resolved columns
+    SCPColumn GetColumn(const char *entry);
+    inline uint32 GetRow(uint32 index) // row that holds index, SCP_INVALID_INT if none
+    {
+        if(_rowlookup.empty())
+            return _GetRowFromMap(index);
+        return index < _rowlookup.size() ? _rowlookup[index] : SCP_INVALID_INT;
+    }
+    inline uint32 *GetCell(uint32 index, const SCPColumn& col)
+    {
+        uint32 row = GetRow(index);
+        return (row != SCP_INVALID_INT && col.id < _fields_per_row) ? &_intbuf[(_fields_per_row * row) + col.id] : NULL;
+    }
+    inline uint32 GetUint32(uint32 index, const SCPColumn& col) { uint32 *t = GetCell(index,col); return t ? *t : 0; }
+    inline int32 GetInt(uint32 index, const SCPColumn& col) { uint32 *t = GetCell(index,col); return t ? *(int32*)t : 0; }
+    inline float GetFloat(uint32 index, const SCPColumn& col) { uint32 *t = GetCell(index,col); return t ? *(float*)t : 0; }
+    inline char *GetString(uint32 index, const SCPColumn& col) { return GetStringByOffset(GetUint32(index,col)); }
+
     inline void *GetRowByIndex(uint32 index) { return GetPtrByField(index,0); }
     uint32 GetFieldByUint32Value(const char *entry, uint32 val);
     uint32 GetFieldByUint32Value(uint32 entry, uint32 val);
@@ -72,6 +103,9 @@ public:
 
     void DumpStructureToFile(const char *fn);
 private:
+    uint32 _GetRowFromMap(uint32 index);
+    void _BuildRowLookup(void);
+
     // text data related
     SCPSourceList sources;
     SCPFieldMap fields;
@@ -85,6 +119,7 @@ private:
     uint32 _stringsize;
     uint32 *_intbuf;
     std::map<uint32,uint32> _indexes, _indexes_reverse; // stores index-to-rowID, rowID-to-index
+    std::vector<uint32> _rowlookup; // index-to-rowID as plain array, empty if the indexes are too sparse for it
     std::map<std::string,SCPFieldDef> _fielddefs;
 };
 
@@ -95,10 +130,10 @@ class SCPDatabaseMgr
 {
     friend class SCPDatabase;
 public:
-    SCPDatabaseMgr() : _compr(0) {}
+    SCPDatabaseMgr() : _compr(0), _generation(0) {}
     SCPDatabase *GetDB(std::string n, bool create = false);
     uint32 AutoLoadFile(const char *fn);
-    inline void DropDB(std::string s) { _map.Delete(stringToLower(s)); }
+    inline void DropDB(std::string s) { _map.Delete(stringToLower(s)); _generation++; }
     bool Compact(const char *dbname, const char *outfile, uint32 compression = 0);
     static uint32 GetDataTypeFromString(const char *s);
     uint32 SearchAndLoad(const char*,bool);
@@ -106,12 +141,29 @@ public:
     bool LoadCompactSCP(const char*, const char*, uint32);
     void SetCompression(uint32 c) { _compr = c; } // min=0, max=9
     uint32 GetCompression(void) { return _compr; }
+    // changes whenever databases are created, dropped or (re)loaded. whoever keeps SCPDatabase pointers
+    // or SCPColumns must resolve them again if it is different from the one they were resolved at.
+    inline uint32 GetGeneration(void) { return _generation; }
 
 private:
     void _FilterFiles(std::deque<std::string>& files, std::string dbname);
     SCPDatabaseMap _map;
     std::deque<std::string> _paths;
     uint32 _compr; // zlib compression level
+    uint32 _generation;
+};
+
+// state of the getscpvalue script command of one instance: the db and key it remembers between calls,
+// and the db and column of the last lookup, resolved again if another one is requested or the databases changed.
+struct SCPValueLookup
+{
+    SCPValueLookup() : keyid(0), generation(0), db(NULL) {}
+    std::string dbname;
+    uint32 keyid;
+    std::string cachedbname, cacheentry; // empty if nothing was resolved yet
+    uint32 generation;
+    SCPDatabase *db;
+    SCPColumn col;
 };
 
 
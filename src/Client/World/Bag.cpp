@@ -4,11 +4,10 @@ Bag::Bag() : Item()
 {
     _type |= TYPE_CONTAINER;
     _typeid = TYPEID_CONTAINER;
-    _valuescount = Object::maxvalues[_typeid];
     _slot = 0;
 }
 
-void Bag::Create(uint64 guid)
+void Bag::Create(uint64 guid, const UpdateFieldLayout *layout)
 {
-    Item::Create(guid);
+    Item::Create(guid, layout);
 }
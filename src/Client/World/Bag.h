@@ -8,7 +8,7 @@ class Bag : public Item
 {
 public:
     Bag();
-    void Create(uint64);
+    void Create(uint64, const UpdateFieldLayout *);
 
 private:
 
@@ -268,7 +268,7 @@ void Channel::HandleListRequest(WorldPacket& recvPacket)
 		logcustom(0,WHITE,"%s ["I64FMT"] %s %s",pname.c_str(),i->first,muted?"(muted)":"",mod?"(moderator)":"");
 
         // DefScript binding
-        l->push_back(DefScriptTools::toString(guid));
+        l->Add(DefScriptTools::toString(guid));
 	}
 }
 
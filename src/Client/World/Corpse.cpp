@@ -4,10 +4,9 @@ Corpse::Corpse()
 {
     _type=TYPE_CORPSE;
     _typeid=TYPEID_CORPSE;
-    _valuescount=Object::maxvalues[_typeid];
 }
 
-void Corpse::Create(uint64 guid)
+void Corpse::Create(uint64 guid, const UpdateFieldLayout *layout)
 {
-    Object::Create(guid);
+    Object::Create(guid, layout);
 }
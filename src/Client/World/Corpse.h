@@ -7,7 +7,7 @@ class Corpse : public WorldObject
 {
 public:
     Corpse();
-    void Create(uint64);
+    void Create(uint64, const UpdateFieldLayout *);
 
 private:
 
@@ -5,10 +5,9 @@ DynamicObject::DynamicObject() : WorldObject()
     _uint32values=NULL;
     _type=TYPE_DYNAMICOBJECT;
     _typeid=TYPEID_DYNAMICOBJECT;
-    _valuescount=Object::maxvalues[_typeid];
 }
 
-void DynamicObject::Create(uint64 guid)
+void DynamicObject::Create(uint64 guid, const UpdateFieldLayout *layout)
 {
-    Object::Create(guid);
+    Object::Create(guid, layout);
 }
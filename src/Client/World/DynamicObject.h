@@ -7,7 +7,7 @@ class DynamicObject : public WorldObject
 {
 public:
     DynamicObject();
-    void Create(uint64);
+    void Create(uint64, const UpdateFieldLayout *);
 
 private:
 
@@ -0,0 +1,138 @@
+#include <algorithm>
+#include "common.h"
+#include "PseuWoW.h"
+#include "DefScript/DefScript.h"
+#include "DefScript/DefScriptTools.h"
+#include "Object.h"
+#include "FieldWatch.h"
+
+using namespace DefScriptTools;
+
+FieldWatchMgr::FieldWatchMgr()
+{
+    _instance = NULL;
+    _layout = NULL;
+    _nextid = 1;
+}
+
+void FieldWatchMgr::SetInstance(PseuInstance *in)
+{
+    _instance = in;
+}
+
+void FieldWatchMgr::SetLayout(const UpdateFieldLayout *layout)
+{
+    _layout = layout;
+}
+
+uint32 FieldWatchMgr::Add(uint64 guid, uint8 typeId, UpdateFieldName field, uint16 count, FieldWatchListener *listener)
+{
+    if(!_layout || !count)
+        return 0;
+    uint16 first = _layout->fields[field].offset;
+    return Add(guid, typeId, first, first + count - 1, listener);
+}
+
+uint32 FieldWatchMgr::Add(uint64 guid, uint8 typeId, uint16 first, uint16 last, FieldWatchListener *listener, const std::string& script)
+{
+    if(last < first || (!listener && script.empty()))
+        return 0;
+    FieldWatch w;
+    w.id = _nextid++;
+    w.guid = guid;
+    w.typeId = typeId;
+    w.first = first;
+    w.last = last;
+    w.listener = listener;
+    w.script = script;
+    _watches.push_back(w);
+    return w.id;
+}
+
+// watches can be removed from inside a callback, so the copies of a dispatch in progress
+// are only marked as removed (id 0) and skipped
+void FieldWatchMgr::Remove(uint32 id)
+{
+    for(uint32 i = 0; i < _watches.size(); i++)
+    {
+        if(_watches[i].id == id)
+        {
+            _watches.erase(_watches.begin() + i);
+            break;
+        }
+    }
+    for(uint32 i = 0; i < _active.size(); i++)
+        if(_active[i].id == id)
+            _active[i].id = 0;
+}
+
+void FieldWatchMgr::RemoveListener(FieldWatchListener *listener)
+{
+    for(uint32 i = _watches.size(); i > 0; i--)
+        if(_watches[i-1].listener == listener)
+            Remove(_watches[i-1].id);
+}
+
+void FieldWatchMgr::RemoveScript(const std::string& script)
+{
+    for(uint32 i = _watches.size(); i > 0; i--)
+        if(!_watches[i-1].listener && _watches[i-1].script == script)
+            Remove(_watches[i-1].id);
+}
+
+bool FieldWatchMgr::_Matches(const FieldWatch& w, Object *obj)
+{
+    return (!w.guid || w.guid == obj->GetGUID())
+        && (w.typeId >= TYPEID_MAX || w.typeId == obj->GetTypeId())
+        && w.first < obj->GetValuesCount();
+}
+
+bool FieldWatchMgr::Begin(Object *obj)
+{
+    _active.clear();
+    for(uint32 i = 0; i < _watches.size(); i++)
+        if(_Matches(_watches[i], obj))
+            _active.push_back(_watches[i]);
+    if(_active.empty())
+        return false;
+
+    uint32 count = obj->GetValuesCount();
+    _dirty.assign((count + 31) >> 5, 0);
+    if(_old.size() < count)
+        _old.resize(count);
+    return true;
+}
+
+void FieldWatchMgr::Dispatch(Object *obj)
+{
+    uint64 guid = obj->GetGUID();
+    uint32 count = obj->GetValuesCount();
+    for(uint32 i = 0; i < _active.size(); i++)
+    {
+        uint32 last = std::min<uint32>(_active[i].last, count - 1);
+        for(uint32 v = _active[i].first; v <= last; v++)
+        {
+            if(!(_dirty[v >> 5] & (1 << (v & 31))))
+                continue;
+            FieldWatch& w = _active[i];
+            if(!w.id)
+                break; // removed by a previous callback
+            uint32 newval = obj->GetUInt32Value((uint16)v);
+            if(w.listener)
+            {
+                w.listener->OnFieldChanged(obj, v, _old[v], newval);
+            }
+            else if(_instance)
+            {
+                CmdSet Set;
+                Set.defaultarg = toString(guid);
+                Set.arg[0] = toString((uint64)v);
+                Set.arg[1] = toString((uint64)newval);
+                Set.arg[2] = toString((uint64)_old[v]);
+                Set.arg[3] = toString((uint64)obj->GetTypeId());
+                _instance->GetScripts()->RunScriptIfExists(w.script, &Set);
+            }
+        }
+    }
+    _active.clear();
+}
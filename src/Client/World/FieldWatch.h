@@ -0,0 +1,75 @@
+#ifndef _FIELDWATCH_H
+#define _FIELDWATCH_H
+
+#include "common.h"
+#include <vector>
+#include "UpdateFields.h"
+
+class Object;
+class PseuInstance;
+struct UpdateFieldLayout;
+
+// C++ side of a field watch. OnFieldChanged() is called once for every watched value
+// that got a different value from the server, after the whole values block was applied to the object.
+class FieldWatchListener
+{
+public:
+    virtual ~FieldWatchListener() {}
+    virtual void OnFieldChanged(Object *obj, uint16 offset, uint32 oldval, uint32 newval) = 0;
+};
+
+struct FieldWatch
+{
+    uint32 id;
+    uint64 guid; // 0: any object
+    uint8 typeId; // TYPEID_MAX: any type
+    uint16 first, last; // value offsets, inclusive
+    FieldWatchListener *listener; // C++ subscriber or NULL ...
+    std::string script; // ... DefScript subscriber
+};
+
+// subscriptions to changes of update fields. _ValuesUpdate() records which values of an object really
+// changed (not just which ones were sent), and only the watches that cover one of them are notified,
+// so nothing has to poll object values.
+// script subscribers are called with @def=guid, @0=value offset, @1=new value, @2=old value, @3=typeid.
+// the initial values of newly created objects count as changes from 0.
+// callbacks may add and remove watches, but must not delete the object.
+class FieldWatchMgr
+{
+public:
+    FieldWatchMgr();
+    void SetInstance(PseuInstance*);
+    void SetLayout(const UpdateFieldLayout*);
+
+    // watch count values starting at field (count > 1 for array fields, e.g. UNIT_FIELD_AURA)
+    uint32 Add(uint64 guid, uint8 typeId, UpdateFieldName field, uint16 count, FieldWatchListener *listener);
+    // watch the raw value offsets first...last
+    uint32 Add(uint64 guid, uint8 typeId, uint16 first, uint16 last, FieldWatchListener *listener, const std::string& script = "");
+    void Remove(uint32 id);
+    void RemoveListener(FieldWatchListener *listener);
+    void RemoveScript(const std::string& script);
+    inline bool Empty(void) { return _watches.empty(); }
+
+    // called from the values update. Begin() returns false if no watch is interested in obj,
+    // then the caller doesn't have to compare values at all.
+    bool Begin(Object *obj);
+    inline void Changed(uint16 offset, uint32 oldval)
+    {
+        _dirty[offset >> 5] |= 1 << (offset & 31);
+        _old[offset] = oldval;
+    }
+    void Dispatch(Object *obj);
+
+private:
+    bool _Matches(const FieldWatch& w, Object *obj);
+
+    PseuInstance *_instance;
+    const UpdateFieldLayout *_layout;
+    std::vector<FieldWatch> _watches;
+    std::vector<FieldWatch> _active; // watches interested in the object currently updated
+    std::vector<uint32> _dirty; // bitset of the values that changed in the current update
+    std::vector<uint32> _old; // previous values, only valid where the dirty bit is set
+    uint32 _nextid;
+};
+
+#endif
@@ -5,10 +5,9 @@ GameObject::GameObject() : WorldObject()
     _uint32values=NULL;
     _type|=TYPE_GAMEOBJECT;
     _typeid=TYPEID_GAMEOBJECT;
-    _valuescount=Object::maxvalues[_typeid];
 }
 
-void GameObject::Create(uint64 guid)
+void GameObject::Create(uint64 guid, const UpdateFieldLayout *layout)
 {
-    Object::Create(guid);
+    Object::Create(guid, layout);
 }
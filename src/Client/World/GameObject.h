@@ -373,7 +373,7 @@ class GameObject : public WorldObject
 {
 public:
     GameObject();
-    void Create(uint64);
+    void Create(uint64, const UpdateFieldLayout *);
 
 private:
 
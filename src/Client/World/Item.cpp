@@ -134,13 +134,12 @@ Item::Item()
     _type |= TYPE_ITEM;
     _typeid = TYPEID_ITEM;
 
-    _valuescount = Object::maxvalues[_typeid];
     _slot = 0;
     //_bag = NULL; // not yet implemented
 }
 
-void Item::Create(uint64 guid)
+void Item::Create(uint64 guid, const UpdateFieldLayout *layout)
 {
-    Object::Create(guid);
+    Object::Create(guid, layout);
     // what else?
 }
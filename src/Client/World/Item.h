@@ -442,7 +442,7 @@ class Item : public Object
 {
 public:
     Item();
-    void Create(uint64);
+    void Create(uint64, const UpdateFieldLayout *);
     uint8 GetSlot(void) { return _slot; }
     void SetSlot(uint8 nr) { _slot = nr; }
     uint32 GetEntry() const { return GetUInt32Value(OBJECT_FIELD_ENTRY); }
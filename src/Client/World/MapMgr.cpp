@@ -2,6 +2,7 @@
 #include "log.h"
 #include "MemoryDataHolder.h"
 #include "MapTile.h"
+#include "NavMesh.h"
 #include "MapMgr.h"
 
 
@@ -120,25 +121,47 @@ void MapMgr::_LoadTile(uint32 gx, uint32 gy, uint32 m)
 
     if( !_tiles->GetTile(gx,gy) )
     {
+        // doodads, WMOs and sound emitters are only of interest for the GUI,
+        // rendering data is loaded later from the same file, if needed
+        uint32 loadflags = MAPTILE_LOAD_TERRAIN;
+        if(_instance->GetConf()->enablegui || _instance->GetGUI())
+            loadflags |= MAPTILE_LOAD_OBJECTS;
+
+        // without GUI, the terrain file generated by stuffextract is all we need, if there is one
+        if(!(loadflags & MAPTILE_LOAD_OBJECTS))
+        {
+            char terrainfn[255];
+            sprintf(terrainfn,"./data/maps/%u_%u_%u.hmp",m,gx,gy);
+            MapTile *tile = new MapTile();
+            if(tile->LoadTerrain(terrainfn))
+            {
+                logdebug("MAPMGR: Loaded terrain '%s'",terrainfn);
+                tile->SetSourceFile(buf);
+                _AttachNavTile(tile,gx,gy,m);
+                _tiles->SetTile(tile,gx,gy);
+                return;
+            }
+            delete tile;
+        }
+
         MemoryDataHolder::MemoryDataResult mdr = MemoryDataHolder::GetFileBasic(buf);
         if(mdr.flags & MemoryDataHolder::MDH_FILE_OK && mdr.data.size)
         {
-            ByteBuffer bb(mdr.data.size);
-            bb.append(mdr.data.ptr,mdr.data.size);
+            MapTile *tile = new MapTile();
+            bool loaded = tile->LoadFromADT((const uint8*)mdr.data.ptr, mdr.data.size, loadflags);
             MemoryDataHolder::Delete(buf);
-            ADTFile *adt = new ADTFile();
-            if(adt->LoadMem(bb))
+            if(loaded)
             {
               logdebug("MAPMGR: Loaded ADT '%s'",buf);
-              MapTile *tile = new MapTile();
-              tile->ImportFromADT(adt);
+              tile->SetSourceFile(buf);
+              _AttachNavTile(tile,gx,gy,m);
               _tiles->SetTile(tile,gx,gy);
             }
             else
             {
               logerror("MAPMGR: Error loading ADT '%s'",buf);//This should not happen!!
+              delete tile;
             }
-            delete adt;
             logdebug("MAPMGR: Imported MapTile (%u, %u) for map %u",gx,gy,m);
         }
         else
@@ -152,6 +175,18 @@ void MapMgr::_LoadTile(uint32 gx, uint32 gy, uint32 m)
     }
 }
 
+// walkability data generated by stuffextract, only needed for pathfinding
+void MapMgr::_AttachNavTile(MapTile *tile, uint32 gx, uint32 gy, uint32 m)
+{
+    char navfn[255];
+    sprintf(navfn,"./data/maps/%u_%u_%u.nav",m,gx,gy);
+    NavTile *nav = new NavTile();
+    if(nav->Load(navfn))
+        tile->SetNavTile(nav);
+    else
+        delete nav;
+}
+
 void MapMgr::_UnloadOldTiles(void)
 {
     for(int32 gy=0; gy<64; gy++)
@@ -228,6 +263,48 @@ float MapMgr::GetZ(float x, float y)
     return INVALID_HEIGHT;
 }
 
+// resolve the heights of many points in one go, points should be ordered by position
+// (a path, a sampling grid) so that runs of them fall on the same tile and chunk.
+void MapMgr::GetZ(MapHeightQuery *q, uint32 count)
+{
+    uint32 i = 0;
+    while(i < count)
+    {
+        GridCoordPair gcoords = GetTransformGridCoordPair(q[i].x,q[i].y);
+        uint32 run = 1;
+        for( ; i + run < count; run++)
+        {
+            GridCoordPair next = GetTransformGridCoordPair(q[i+run].x,q[i+run].y);
+            if(next.x != gcoords.x || next.y != gcoords.y)
+                break;
+        }
+        MapTile *tile = _tiles->GetTile(gcoords.x,gcoords.y);
+        if(tile)
+            tile->GetZ(q + i, run);
+        else
+        {
+            logerror("MapMgr::GetZ() called for not loaded MapTile (%u, %u) for %u points",gcoords.x,gcoords.y,run);
+            for(uint32 j = 0; j < run; j++)
+                q[i+j].z = INVALID_HEIGHT;
+        }
+        i += run;
+    }
+}
+
+// find a walkable path on the loaded tiles, see PathFinder::FindPath()
+bool MapMgr::FindPath(float sx, float sy, float ex, float ey, std::vector<MapHeightQuery>& path)
+{
+    PathFinder pf(_tiles);
+    return pf.FindPath(sx,sy,ex,ey,path);
+}
+
+uint32 MapMgr::GetAreaId(float x, float y)
+{
+    GridCoordPair gcoords = GetTransformGridCoordPair(x,y);
+    MapTile *tile = _tiles->GetTile(gcoords.x,gcoords.y);
+    return tile ? tile->GetAreaId(x,y) : 0;
+}
+
 std::string MapMgr::GetLoadedTilesString(void)
 {
     std::stringstream s;
@@ -6,6 +6,7 @@
 
 class MapTileStorage;
 class MapTile;
+struct MapHeightQuery;
 
 struct GridCoordPair
 {
@@ -23,6 +24,9 @@ public:
     void Update(float,float,uint32);
     void Flush(void);
     float GetZ(float,float);
+    void GetZ(MapHeightQuery*,uint32);
+    uint32 GetAreaId(float,float);
+    bool FindPath(float,float,float,float,std::vector<MapHeightQuery>&);
     static uint32 GetGridCoord(float f);
     static GridCoordPair GetTransformGridCoordPair(float x, float y);
     MapTile *GetTile(uint32 xg, uint32 yg, bool forceLoad = false);
@@ -40,6 +44,7 @@ private:
     SCPDatabase* mapdb;
     MapTileStorage *_tiles;
     void _LoadTile(uint32,uint32,uint32);
+    void _AttachNavTile(MapTile*,uint32,uint32,uint32);
     void _LoadNearTiles(uint32,uint32,uint32);
     void _UnloadOldTiles(void);
     uint32 _mapid;
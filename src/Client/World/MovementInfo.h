@@ -91,7 +91,7 @@ enum SplineFlags{
 
 struct MovementInfo
 {
-    static uint8 _c; //Version switch helper
+    uint8 _c; // client version of the session the packet belongs to, selects the format
 
     // Read/Write methods
     void Read(ByteBuffer &data);
@@ -116,7 +116,7 @@ struct MovementInfo
     // spline
     float   u_unk1;
 
-    MovementInfo()
+    MovementInfo(uint8 client) : _c(client)
     {
         flags = time = t_time = fallTime = flags2 = 0;
         t_seat = 0;
@@ -4,6 +4,7 @@
 #include "MovementMgr.h"
 #include "Player.h"
 #include "MovementInfo.h"
+#include "MapMgr.h"
 
 MovementMgr::MovementMgr()
 {
@@ -36,7 +37,7 @@ void MovementMgr::_BuildPacket(uint16 opcode)
     WorldPacket *wp = new WorldPacket(opcode,4+2+4+16); // it can be larger, if we are jumping, on transport or swimming
     if(_instance->GetConf()->client > CLIENT_TBC)
       wp->appendPackGUID(_mychar->GetGUID());
-    MovementInfo mi;
+    MovementInfo mi(_instance->GetConf()->client);
     mi.SetMovementFlags(_moveFlags);
     mi.time = getMSTime();
     mi.pos = _mychar->GetPosition();
@@ -135,6 +136,12 @@ void MovementMgr::Update(bool sendDirect)
         }
     }*/
 
+    if(!sendDirect && _movemode == MOVEMODE_AUTO && !_path.empty())
+    {
+        _FollowPath();
+        pos = _mychar->GetPosition();
+    }
+
     // if we are moving, and 500ms have passed, send an heartbeat packet. just in case 500ms have passed but the packet is sent by another function, do not send here
     if( !sendDirect && (_moveFlags & MOVEMENTFLAG_ANY_MOVE_NOT_TURNING) && _optime + MOVE_HEARTBEAT_DELAY < getMSTime())
     {
@@ -150,9 +157,82 @@ void MovementMgr::Update(bool sendDirect)
     // TODO: apply gravity, handle falling, swimming, etc.
 }
 
-// stops
+// find a path to (x,y) and start walking it. the path can only go over loaded map tiles with nav data.
+bool MovementMgr::MoveTo(float x, float y)
+{
+    World *world = _instance->GetWSession()->GetWorld();
+    if(!world || !world->GetMapMgr())
+        return false;
+    WorldPosition pos = _mychar->GetPosition();
+    std::vector<MapHeightQuery> path;
+    if(!world->GetMapMgr()->FindPath(pos.x,pos.y,x,y,path))
+    {
+        logdetail("MovementMgr: No path from (%.2f, %.2f) to (%.2f, %.2f)",pos.x,pos.y,x,y);
+        return false;
+    }
+    logdebug("MovementMgr: Moving to (%.2f, %.2f), %u waypoints",x,y,(uint32)path.size());
+    _path.assign(path.begin(), path.end());
+    _movemode = MOVEMODE_AUTO;
+    _updatetime = getMSTime();
+    _FaceTo(_path.front().x, _path.front().y);
+    MoveStartForward();
+    return true;
+}
+
+void MovementMgr::_FaceTo(float x, float y)
+{
+    WorldPosition pos = _mychar->GetPosition();
+    float o = atan2(y - pos.y, x - pos.x);
+    if(o < 0)
+        o += float(2 * M_PI);
+    if(fabs(o - pos.o) < 0.001f)
+        return;
+    pos.o = o;
+    _mychar->SetPosition(pos);
+    MoveSetFacing();
+}
+
+// walk towards the next waypoint for the time passed since the last update
+void MovementMgr::_FollowPath(void)
+{
+    WorldPosition pos = _mychar->GetPosition();
+    float dist = _movespeed;
+    while(!_path.empty())
+    {
+        MapHeightQuery& wp = _path.front();
+        float dx = wp.x - pos.x, dy = wp.y - pos.y;
+        float left = sqrt(dx*dx + dy*dy);
+        if(left > dist)
+        {
+            pos.x += dx / left * dist;
+            pos.y += dy / left * dist;
+            float z = _instance->GetWSession()->GetWorld()->GetPosZ(pos.x,pos.y);
+            if(z != INVALID_HEIGHT)
+                pos.z = z;
+            _mychar->SetPosition(pos);
+            return;
+        }
+        // waypoint reached, turn to the next one
+        dist -= left;
+        pos.x = wp.x;
+        pos.y = wp.y;
+        if(wp.z != INVALID_HEIGHT)
+            pos.z = wp.z;
+        _mychar->SetPosition(pos);
+        _path.pop_front();
+        if(!_path.empty())
+            _FaceTo(_path.front().x, _path.front().y);
+        pos = _mychar->GetPosition();
+    }
+    // arrived
+    MoveStop();
+}
+
+// stops, also ends walking along a path
 void MovementMgr::MoveStop(void)
 {
+    _path.clear();
+    _movemode = MOVEMODE_MANUAL;
     if(!(_moveFlags & (MOVEMENTFLAG_FORWARD | MOVEMENTFLAG_BACKWARD)))
         return;
     _moveFlags &= ~(MOVEMENTFLAG_FORWARD | MOVEMENTFLAG_BACKWARD | MOVEMENTFLAG_WALK_MODE);
@@ -3,6 +3,7 @@
 
 #include "common.h"
 #include "MovementInfo.h"
+#include "MapTile.h"
 
 #define MOVE_HEARTBEAT_DELAY 500
 #define MOVE_TURN_UPDATE_DIFF 0.15f // not sure about original/real value, but this seems good
@@ -59,10 +60,14 @@ public:
     bool IsWalking(void); // walking straight forward/backward?
     bool IsStrafing(void); // strafing left/right?
     inline void SetFallTime(uint32 falltime){_falltime = falltime; }
+    bool MoveTo(float x, float y); // walk to (x,y) along a path, switches to MOVEMODE_AUTO until arrived
+    inline bool HasPath(void) { return !_path.empty(); }
 
 
 private:
     void _BuildPacket(uint16);
+    void _FollowPath(void);
+    void _FaceTo(float x, float y);
     PseuInstance *_instance;
     MyCharacter *_mychar;
     uint32 _moveFlags; // server relevant flags (move forward/backward/swim/fly/jump/etc)
@@ -74,6 +79,7 @@ private:
     uint32 _falltime;
     UnitMoveType _movetype; // index used for speed selection
     bool _moved;
+    std::deque<MapHeightQuery> _path; // remaining waypoints in automatic mode
 
 
 };
@@ -52,6 +52,8 @@ void ObjMgr::Remove(uint64 guid, bool del)
     if(o)
     {
         o->_SetDepleted();
+        if(o->IsWorldObject())
+            _grid.Remove((WorldObject*)o);
         if(!del)
             logdebug("ObjMgr: "I64FMT" '%s' -> depleted.",guid,o->GetName().c_str());
         PseuGUI *gui = _instance->GetGUI();
@@ -83,6 +85,8 @@ void ObjMgr::Add(Object *o)
     {
         delete ox; // only delete pointer, everything else is already reserved for the just added new obj
     }
+    if(o->IsWorldObject())
+        _grid.Insert((WorldObject*)o);
 
     if(PseuGUI *gui = _instance->GetGUI())
         gui->NotifyObjectCreation(o);
@@ -92,14 +96,10 @@ Object *ObjMgr::GetObj(uint64 guid, bool also_depleted)
 {
     if(!guid)
         return NULL;
-    for(ObjectMap::iterator i = _obj.begin(); i!=_obj.end(); i++)
-        if(i->second->GetGUID() == guid)
-        {
-            if(i->second->_IsDepleted() && !also_depleted)
-                return NULL;
-            return i->second;
-        }
-    return NULL;
+    ObjectMap::iterator i = _obj.find(guid);
+    if(i == _obj.end() || (i->second->_IsDepleted() && !also_depleted))
+        return NULL;
+    return i->second;
 }
 
 // iterate over all objects and assign a name to all matching the entry and typeid
@@ -188,6 +188,8 @@ bool ObjMgr::CreatureNonExistent(uint32 id)
 void ObjMgr::Add(GameobjectTemplate *go)
 {
     _go_templ[go->entry] = go;
+    if(PseuGUI *gui = _instance->GetGUI())
+        gui->NotifyGOTemplateArrival(go->entry); // DrawObjects may be waiting for it
 }
 
 GameobjectTemplate *ObjMgr::GetGOTemplate(uint32 entry)
@@ -6,6 +6,7 @@
 #include "Item.h"
 #include "Unit.h"
 #include "GameObject.h"
+#include "ObjectGrid.h"
 
 typedef std::map<uint32,ItemProto*> ItemProtoMap;
 typedef std::map<uint32,CreatureTemplate*> CreatureTemplateMap;
@@ -65,6 +66,7 @@ public:
     Object *GetObj(uint64 guid, bool also_depleted = false);
     inline uint32 GetObjectCount(void) { return _obj.size(); }
     uint32 AssignNameToObj(uint32 entry, uint8 type, std::string name);
+    inline ObjectGrid& GetGrid(void) { return _grid; } // spatial index of all non-depleted world objects
     void ReNotifyGUI(void);
 
 private:
@@ -73,6 +75,7 @@ private:
     GOTemplateMap _go_templ;
 
     ObjectMap _obj;
+    ObjectGrid _grid;
     std::set<uint32> _noitem;
     std::set<uint32> _reqpnames;
     std::set<uint32> _nocreature;
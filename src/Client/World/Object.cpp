@@ -1,36 +1,103 @@
 #include "common.h"
+#include "zthread/Guard.h"
 #include "WorldSession.h"
 
 #include "Object.h"
 
+#define OBJECTPOOL_MAX_FREE 512 // kept blocks per block size
+
+// memory of deleted objects and their value arrays, sorted by block size.
+// there are only a few different sizes, one per object type and one per values count.
+class ObjectMemPool
+{
+public:
+    ObjectMemPool() { allocs = 0; }
+    void *Alloc(size_t size)
+    {
+        ZThread::Guard<ZThread::FastMutex> g(_mutex);
+        std::vector<void*>& fl = _free[size];
+        if(fl.empty())
+        {
+            allocs++;
+            return ::operator new(size);
+        }
+        void *p = fl.back();
+        fl.pop_back();
+        return p;
+    }
+    void Free(void *p, size_t size)
+    {
+        ZThread::Guard<ZThread::FastMutex> g(_mutex);
+        std::vector<void*>& fl = _free[size];
+        if(fl.size() < OBJECTPOOL_MAX_FREE)
+            fl.push_back(p);
+        else
+            ::operator delete(p);
+    }
+    uint32 allocs;
+
+private:
+    ZThread::FastMutex _mutex;
+    std::map<size_t, std::vector<void*> > _free;
+};
+
+// never deleted on purpose, objects may still be freed after static destructors ran
+static ObjectMemPool *GetObjectMemPool(void)
+{
+    static ObjectMemPool *pool = new ObjectMemPool;
+    return pool;
+}
+
+void *Object::operator new(size_t size)
+{
+    return GetObjectMemPool()->Alloc(size);
+}
+
+// the destructor is virtual, so size is that of the most derived class
+void Object::operator delete(void *p, size_t size)
+{
+    if(p)
+        GetObjectMemPool()->Free(p, size);
+}
+
+// amount of objects and value arrays that could not be served from freed memory
+uint32 Object::GetHeapAllocCount(void)
+{
+    return GetObjectMemPool()->allocs;
+}
+
 Object::Object()
 {
     _depleted = false;
     _uint32values=NULL;
     _type=TYPE_OBJECT;
     _typeid=TYPEID_OBJECT;
-    _valuescount=Object::maxvalues[_typeid]; // base class. this value will be set by derived classes
+    _layout=NULL;
+    _fields=NULL;
+    _valuescount=0; // known once Create() got the layout
 }
 
 Object::~Object()
 {
-    ASSERT(_valuescount > 0);
-    DEBUG(logdebug("~Object() GUID="I64FMT,GetGUID()));
+    DEBUG(logdebug("~Object() GUID=" I64FMT,_uint32values ? GetGUID() : 0));
     if(_uint32values)
-        delete [] _uint32values;
+        GetObjectMemPool()->Free(_uint32values, _valuescount*sizeof(uint32));
 }
 
 void Object::_InitValues()
 {
-    _uint32values = new uint32[ _valuescount ];
+    _uint32values = (uint32*)GetObjectMemPool()->Alloc(_valuescount*sizeof(uint32));
     memset(_uint32values, 0, _valuescount*sizeof(uint32));
 }
 
-void Object::Create( uint64 guid )
+void Object::Create( uint64 guid, const UpdateFieldLayout *layout )
 {
+    ASSERT(layout && !_uint32values);
+    _layout = layout;
+    _fields = layout->fields;
+    _valuescount = layout->maxvalues[_typeid];
     ASSERT(_valuescount > 0);
-    if(!_uint32values)
-        _InitValues();
+    _InitValues();
 
     SetUInt64Value( OBJECT_FIELD_GUID, guid );
     SetUInt32Value( OBJECT_FIELD_TYPE, _type );
@@ -41,6 +108,8 @@ WorldObject::WorldObject()
 {
     _depleted = false;
     _m = 0;
+    _grid = NULL;
+    _gridcell = 0;
 }
 
 void WorldObject::SetPosition(float x, float y, float z, float o)
@@ -49,6 +118,8 @@ void WorldObject::SetPosition(float x, float y, float z, float o)
     _wpos.y = y;
     _wpos.z = z;
     _wpos.o = o;
+    if(_grid)
+        _grid->Relocate(this);
 }
 
 void WorldObject::SetPosition(float x, float y, float z, float o, uint16 _map)
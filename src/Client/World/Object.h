@@ -6,10 +6,11 @@
 #include "common.h"
 #include "HelperDefs.h"
 #include "World.h"
+#include "ObjectGrid.h"
 
 struct UpdateField
 {
-  UpdateField(){};
+  UpdateField():offset(0),type(0){};
   UpdateField(uint16 o, uint16 t):offset(o),type(t){};
   uint16 offset;
   uint16 type;
@@ -44,10 +45,25 @@ enum TYPEID
     TYPEID_MAX
 };
 
+// offsets and types of all update fields of one client version, and the size of the value array
+// of each object type. one constant layout per client exists, every session uses the layout
+// of its client and every object the layout of the session that created it.
+struct UpdateFieldLayout
+{
+    uint32 maxvalues[TYPEID_MAX];
+    UpdateField fields[UPDATEFIELDS_NAME_COUNT];
+};
+
+const UpdateFieldLayout *GetUpdateFieldLayout(uint8 client); // NULL if the client is not supported
+
 class Object
 {
 public:
     virtual ~Object();
+    // objects come and go all the time while moving around, their memory is kept for the next ones
+    static void *operator new(size_t size);
+    static void operator delete(void *p, size_t size);
+    static uint32 GetHeapAllocCount(void);
     inline const uint64 GetGUID() const { return GetUInt64Value(OBJECT_FIELD_GUID); }
     inline const uint32 GetGUIDLow() const { return GetUInt32Value(OBJECT_FIELD_GUID_LOW); }
     inline const uint32 GetGUIDHigh() const { return GetUInt32Value(OBJECT_FIELD_GUID_HIGH); }
@@ -68,29 +84,34 @@ public:
     inline bool IsWorldObject(void) { return _type & (TYPE_PLAYER | TYPE_UNIT | TYPE_CORPSE | TYPE_DYNAMICOBJECT | TYPE_GAMEOBJECT); }
     inline const uint32 GetUInt32Value( UpdateFieldName index ) const
     {
-        return _uint32values[ Object::updatefields[index].offset ];
+        return _uint32values[ _fields[index].offset ];
+    }
+
+    inline uint32 GetUInt32Value( uint16 offset ) const
+    {
+        return _uint32values[ offset ];
     }
 
     inline const uint64 GetUInt64Value( UpdateFieldName index ) const
     {
-        return *((uint64*)&(_uint32values[ Object::updatefields[index].offset ]));
+        return *((uint64*)&(_uint32values[ _fields[index].offset ]));
     }
 
     inline bool HasFlag( UpdateFieldName index, uint32 flag ) const
     {
-        return (_uint32values[ Object::updatefields[index].offset ] & flag) != 0;
+        return (_uint32values[ _fields[index].offset ] & flag) != 0;
     }
     inline const float GetFloatValue( UpdateFieldName index ) const
     {
-        return _floatvalues[ Object::updatefields[index].offset ];
+        return _floatvalues[ _fields[index].offset ];
     }
     inline void SetFloatValue( UpdateFieldName index, float value )
     {
-        _floatvalues[ Object::updatefields[index].offset ] = value;
+        _floatvalues[ _fields[index].offset ] = value;
     }
     inline void SetUInt32Value( UpdateFieldName index, uint32 value )
     {
-        _uint32values[ Object::updatefields[index].offset ] = value;
+        _uint32values[ _fields[index].offset ] = value;
     }
     inline void SetUInt32Value( uint16 offset, uint32 value )
     {
@@ -98,28 +119,29 @@ public:
     }
     inline void SetUInt64Value( UpdateFieldName index, uint64 value )
     {
-        *((uint64*)&(_uint32values[ Object::updatefields[index].offset ])) = value;
+        *((uint64*)&(_uint32values[ _fields[index].offset ])) = value;
     }
 
     inline void SetName(std::string name) { _name = name; }
-    inline std::string GetName(void) { return _name; }
+    inline const std::string& GetName(void) { return _name; }
 
     inline float GetObjectSize() const
     {
-        return ( _valuescount > Object::updatefields[UNIT_FIELD_BOUNDINGRADIUS].offset ) ? _floatvalues[Object::updatefields[UNIT_FIELD_BOUNDINGRADIUS].offset] : 0.39f;
+        return ( _valuescount > _fields[UNIT_FIELD_BOUNDINGRADIUS].offset ) ? _floatvalues[_fields[UNIT_FIELD_BOUNDINGRADIUS].offset] : 0.39f;
     }
 
-    void Create(uint64 guid);
+    // must be called right after construction, the value accessors can only be used after it
+    void Create(uint64 guid, const UpdateFieldLayout *layout);
+    inline const UpdateFieldLayout *GetLayout(void) const { return _layout; }
     inline bool _IsDepleted(void) { return _depleted; }
     inline void _SetDepleted(void) { _depleted = true; }
 
-    static uint32 maxvalues[];
-    static UpdateField updatefields[];
-
 protected:
     Object();
     void _InitValues(void);
 
+    const UpdateFieldLayout *_layout;
+    const UpdateField *_fields; // _layout->fields
     uint16 _valuescount;
     union
     {
@@ -136,11 +158,12 @@ protected:
 
 class WorldObject : public Object
 {
+    friend class ObjectGrid;
 public:
-    virtual ~WorldObject ( ) {}
+    virtual ~WorldObject ( ) { if(_grid) _grid->Remove(this); }
     void SetPosition(float x, float y, float z, float o, uint16 _map);
     void SetPosition(float x, float y, float z, float o);
-    inline void SetPosition(WorldPosition& wp) { _wpos = wp; }
+    inline void SetPosition(WorldPosition& wp) { _wpos = wp; if(_grid) _grid->Relocate(this); }
     inline void SetPosition(WorldPosition& wp, uint16 mapid) { SetPosition(wp); _m = mapid; }
     inline WorldPosition GetPosition(void) {return _wpos; }
     inline WorldPosition *GetPositionPtr(void) {return &_wpos; }
@@ -158,13 +181,15 @@ protected:
     WorldObject();
     WorldPosition _wpos; // coords, orientation
     uint16 _m; // map
+    ObjectGrid *_grid; // grid this object is indexed in, if any
+    uint32 _gridcell;
 
 };
 
-inline uint32 GetValuesCountByTypeId(uint8 tid)
+inline uint32 GetValuesCountByTypeId(const UpdateFieldLayout *layout, uint8 tid)
 {
     if(tid < TYPEID_MAX)
-      return Object::maxvalues[tid];
+      return layout->maxvalues[tid];
     return 0;
 }
 
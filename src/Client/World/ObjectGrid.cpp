@@ -0,0 +1,192 @@
+#include <algorithm>
+#include "common.h"
+#include "zthread/Guard.h"
+#include "Object.h"
+#include "ObjectGrid.h"
+
+// sorts objects by their distance to a point
+struct ObjectDistanceLess
+{
+    ObjectDistanceLess(float px, float py) : x(px), y(py) {}
+    bool operator()(WorldObject *a, WorldObject *b) { return a->GetDistance2d(x,y) < b->GetDistance2d(x,y); }
+    float x,y;
+};
+
+ObjectGrid::~ObjectGrid()
+{
+    Clear();
+}
+
+void ObjectGrid::Insert(WorldObject *o)
+{
+    ZThread::Guard<ZThread::FastMutex> g(_mutex);
+    if(o->_grid)
+        _Remove(o);
+    o->_grid = this;
+    o->_gridcell = _CellKey(_CellCoord(o->GetX()), _CellCoord(o->GetY()));
+    _cells[o->_gridcell].push_back(o);
+}
+
+void ObjectGrid::Remove(WorldObject *o)
+{
+    ZThread::Guard<ZThread::FastMutex> g(_mutex);
+    if(o->_grid == this)
+        _Remove(o);
+}
+
+void ObjectGrid::_Remove(WorldObject *o)
+{
+    CellMap::iterator it = _cells.find(o->_gridcell);
+    if(it != _cells.end())
+    {
+        Cell& cell = it->second;
+        Cell::iterator pos = std::find(cell.begin(), cell.end(), o);
+        if(pos != cell.end())
+        {
+            *pos = cell.back();
+            cell.pop_back();
+        }
+        if(cell.empty())
+            _cells.erase(it);
+    }
+    o->_grid = NULL;
+}
+
+// called after an object moved, most of the time it is still in the same cell
+void ObjectGrid::Relocate(WorldObject *o)
+{
+    uint32 key = _CellKey(_CellCoord(o->GetX()), _CellCoord(o->GetY()));
+    ZThread::Guard<ZThread::FastMutex> g(_mutex);
+    if(o->_grid != this || key == o->_gridcell)
+        return;
+    _Remove(o);
+    o->_grid = this;
+    o->_gridcell = key;
+    _cells[key].push_back(o);
+}
+
+void ObjectGrid::Clear(void)
+{
+    ZThread::Guard<ZThread::FastMutex> g(_mutex);
+    for(CellMap::iterator it = _cells.begin(); it != _cells.end(); it++)
+        for(Cell::iterator i = it->second.begin(); i != it->second.end(); i++)
+            (*i)->_grid = NULL;
+    _cells.clear();
+}
+
+// append all objects in the cells touching the box (x0,y0)-(x1,y1)
+void ObjectGrid::_CollectBox(float x0, float y0, float x1, float y1, uint8 typemask, std::vector<WorldObject*>& result)
+{
+    // cell keys hold 16 bit coords, nothing can be outside of that
+    const float lim = 32767.0f * OBJECTGRID_CELLSIZE;
+    x0 = std::max(-lim, std::min(lim, x0));
+    y0 = std::max(-lim, std::min(lim, y0));
+    x1 = std::max(-lim, std::min(lim, x1));
+    y1 = std::max(-lim, std::min(lim, y1));
+    int32 cx0 = _CellCoord(x0), cx1 = _CellCoord(x1);
+    int32 cy0 = _CellCoord(y0), cy1 = _CellCoord(y1);
+    if(cx1 < cx0 || cy1 < cy0)
+        return;
+    if(uint64(cx1 - cx0 + 1) * uint64(cy1 - cy0 + 1) > _cells.size())
+    {
+        // huge box, cheaper to look at the non-empty cells only
+        for(CellMap::iterator it = _cells.begin(); it != _cells.end(); it++)
+        {
+            int32 cx = int16(it->first >> 16), cy = int16(it->first & 0xFFFF);
+            if(cx < cx0 || cx > cx1 || cy < cy0 || cy > cy1)
+                continue;
+            for(Cell::iterator i = it->second.begin(); i != it->second.end(); i++)
+                if(!typemask || (*i)->IsType(typemask))
+                    result.push_back(*i);
+        }
+        return;
+    }
+    for(int32 cx = cx0; cx <= cx1; cx++)
+    {
+        for(int32 cy = cy0; cy <= cy1; cy++)
+        {
+            CellMap::iterator it = _cells.find(_CellKey(cx,cy));
+            if(it == _cells.end())
+                continue;
+            for(Cell::iterator i = it->second.begin(); i != it->second.end(); i++)
+                if(!typemask || (*i)->IsType(typemask))
+                    result.push_back(*i);
+        }
+    }
+}
+
+// all objects within range (2d, minus object size) of (x,y), unsorted
+uint32 ObjectGrid::GetObjectsInRange(float x, float y, float range, std::vector<WorldObject*>& result, uint8 typemask)
+{
+    result.clear();
+    float r = range + OBJECTGRID_SIZE_MARGIN;
+    {
+        ZThread::Guard<ZThread::FastMutex> g(_mutex);
+        _CollectBox(x - r, y - r, x + r, y + r, typemask, result);
+    }
+    for(uint32 i = 0; i < result.size(); )
+    {
+        if(result[i]->GetDistance2d(x,y) > range)
+        {
+            result[i] = result.back();
+            result.pop_back();
+        }
+        else
+            i++;
+    }
+    return result.size();
+}
+
+// up to count objects within range of (x,y), nearest first.
+// the search starts with the cells next to the point and grows until enough objects are found.
+uint32 ObjectGrid::GetNearestObjects(float x, float y, float range, uint32 count, std::vector<WorldObject*>& result, uint8 typemask)
+{
+    result.clear();
+    if(!count)
+        return 0;
+    for(float r = OBJECTGRID_CELLSIZE; ; r *= 2)
+    {
+        if(r > range)
+            r = range;
+        GetObjectsInRange(x, y, r, result, typemask);
+        if(result.size() >= count || r >= range)
+            break;
+    }
+    if(result.size() > count)
+    {
+        std::partial_sort(result.begin(), result.begin() + count, result.end(), ObjectDistanceLess(x,y));
+        result.resize(count);
+    }
+    else
+        std::sort(result.begin(), result.end(), ObjectDistanceLess(x,y));
+    return result.size();
+}
+
+// objects that are within width of the line (x1,y1)-(x2,y2), for example to find what could block the line of sight.
+// sorted by distance to (x1,y1).
+uint32 ObjectGrid::GetObjectsNearLine(float x1, float y1, float x2, float y2, float width, std::vector<WorldObject*>& result, uint8 typemask)
+{
+    result.clear();
+    float r = width + OBJECTGRID_SIZE_MARGIN;
+    {
+        ZThread::Guard<ZThread::FastMutex> g(_mutex);
+        _CollectBox(std::min(x1,x2) - r, std::min(y1,y2) - r, std::max(x1,x2) + r, std::max(y1,y2) + r, typemask, result);
+    }
+    float dx = x2 - x1, dy = y2 - y1;
+    float len2 = dx*dx + dy*dy;
+    for(uint32 i = 0; i < result.size(); )
+    {
+        // closest point on the line
+        float t = len2 > 0.0f ? ((result[i]->GetX() - x1) * dx + (result[i]->GetY() - y1) * dy) / len2 : 0.0f;
+        t = std::max(0.0f, std::min(1.0f, t));
+        if(result[i]->GetDistance2d(x1 + t * dx, y1 + t * dy) > width)
+        {
+            result[i] = result.back();
+            result.pop_back();
+        }
+        else
+            i++;
+    }
+    std::sort(result.begin(), result.end(), ObjectDistanceLess(x1,y1));
+    return result.size();
+}
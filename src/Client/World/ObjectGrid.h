@@ -0,0 +1,41 @@
+#ifndef _OBJECTGRID_H
+#define _OBJECTGRID_H
+
+#include "common.h"
+#include <map>
+
+#define OBJECTGRID_CELLSIZE 32.0f // yards
+#define OBJECTGRID_SIZE_MARGIN 10.0f // max. object size (bounding radius) expected in range queries
+
+class WorldObject;
+
+// uniform grid over the x/y plane that holds all world objects known to the ObjMgr.
+// objects are moved between cells from WorldObject::SetPosition(), so range and nearest queries
+// only have to look at the few cells around the given position instead of every object.
+// the typemask of the queries is a combination of TYPE_* flags, 0 for any type.
+class ObjectGrid
+{
+public:
+    ~ObjectGrid();
+    void Insert(WorldObject*);
+    void Remove(WorldObject*);
+    void Relocate(WorldObject*);
+    void Clear(void);
+    uint32 GetObjectsInRange(float x, float y, float range, std::vector<WorldObject*>& result, uint8 typemask = 0);
+    uint32 GetNearestObjects(float x, float y, float range, uint32 count, std::vector<WorldObject*>& result, uint8 typemask = 0);
+    uint32 GetObjectsNearLine(float x1, float y1, float x2, float y2, float width, std::vector<WorldObject*>& result, uint8 typemask = 0);
+
+private:
+    typedef std::vector<WorldObject*> Cell;
+    typedef std::map<uint32,Cell> CellMap;
+
+    static inline int32 _CellCoord(float f) { return int32(floor(f / OBJECTGRID_CELLSIZE)); }
+    static inline uint32 _CellKey(int32 cx, int32 cy) { return (uint32(cx & 0xFFFF) << 16) | uint32(cy & 0xFFFF); }
+    void _Remove(WorldObject*);
+    void _CollectBox(float x0, float y0, float x1, float y1, uint8 typemask, std::vector<WorldObject*>& result);
+
+    CellMap _cells;
+    ZThread::FastMutex _mutex;
+};
+
+#endif
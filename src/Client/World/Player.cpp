@@ -13,12 +13,11 @@ Player::Player() : Unit()
 {
     _type |= TYPE_PLAYER;
     _typeid = TYPEID_PLAYER;
-    _valuescount = Object::maxvalues[_typeid];
 }
 
-void Player::Create(uint64 guid)
+void Player::Create(uint64 guid, const UpdateFieldLayout *layout)
 {
-    Object::Create(guid);
+    Object::Create(guid, layout);
 }
 
 MyCharacter::MyCharacter() : Player()
@@ -170,7 +170,7 @@ class Player : public Unit
 {
 public:
     Player();
-    void Create(uint64);
+    void Create(uint64, const UpdateFieldLayout *);
     inline uint8 GetGender() { return GetUInt32Value(PLAYER_BYTES_3); }
     inline uint8 GetSkinId() { return (GetUInt32Value(PLAYER_BYTES) & 0x000000FF); }
     inline uint8 GetFaceId() { return (GetUInt32Value(PLAYER_BYTES) & 0x0000FF00) >> 8; }
@@ -5,12 +5,11 @@ Unit::Unit() : WorldObject()
 {
     _type |= TYPE_UNIT;
     _typeid = TYPEID_UNIT;
-    _valuescount = Object::maxvalues[_typeid];
 }
 
-void Unit::Create(uint64 guid)
+void Unit::Create(uint64 guid, const UpdateFieldLayout *layout)
 {
-    Object::Create(guid);
+    Object::Create(guid, layout);
 }
 
 uint8 Unit::GetGender(void)
@@ -77,7 +77,7 @@ class Unit : public WorldObject
 {
 public:
     Unit();
-    void Create(uint64);
+    void Create(uint64, const UpdateFieldLayout *);
     uint8 GetGender(void);
     void SetSpeed(uint8 speednr, float speed) { _speed[speednr] = speed; }
     float GetSpeed(uint8 speednr) { return _speed[speednr]; }
@@ -17,21 +17,24 @@ void WorldSession::_HandleCompressedUpdateObjectOpcode(WorldPacket& recvPacket)
 {
     uint32 realsize;
     recvPacket >> realsize;
-    ZCompressor z;
-    z.append(recvPacket.contents() + sizeof(uint32),recvPacket.size() - sizeof(uint32));
-    z.Compressed(true);
-    z.RealSize(realsize);
-    z.Inflate();
-    if(z.Compressed())
+    // inflate straight into a pooled packet, no copies in between
+    WorldPacket *wp = _pktpool.Get(recvPacket.GetOpcode(), realsize);
+    if(!_inflater.Inflate(recvPacket.contents() + recvPacket.rpos(), recvPacket.size() - recvPacket.rpos(), *wp, realsize))
     {
-        logerror("_HandleCompressedUpdateObjectOpcode(): Inflate() failed! size=%u realsize=%u",z.size(),realsize);
+        logerror("_HandleCompressedUpdateObjectOpcode(): Inflate() failed! size=%u realsize=%u",recvPacket.size(),realsize);
+        _pktpool.Release(wp);
         return;
     }
-    WorldPacket wp;
-    wp.SetOpcode(recvPacket.GetOpcode());
-    wp.append(z.contents(),z.size());
-
-    _HandleUpdateObjectOpcode(wp);
+    try
+    {
+        _HandleUpdateObjectOpcode(*wp);
+    }
+    catch(...)
+    {
+        _pktpool.Release(wp);
+        throw;
+    }
+    _pktpool.Release(wp);
 }
 
 void WorldSession::_HandleUpdateObjectOpcode(WorldPacket& recvPacket)
@@ -111,7 +114,7 @@ void WorldSession::_HandleUpdateObjectOpcode(WorldPacket& recvPacket)
                     case TYPEID_ITEM:
                         {
                             Item *item = new Item();
-                            item->Create(uguid);
+                            item->Create(uguid, _fieldlayout);
                             objmgr.Add(item);
                             logdebug("Created Item with guid "I64FMT,uguid);
                             break;
@@ -119,7 +122,7 @@ void WorldSession::_HandleUpdateObjectOpcode(WorldPacket& recvPacket)
                     case TYPEID_CONTAINER:
                         {
                             Bag *bag = new Bag();
-                            bag->Create(uguid);
+                            bag->Create(uguid, _fieldlayout);
                             objmgr.Add(bag);
                             logdebug("Created Bag with guid "I64FMT,uguid);
                             break;
@@ -127,7 +130,7 @@ void WorldSession::_HandleUpdateObjectOpcode(WorldPacket& recvPacket)
                     case TYPEID_UNIT:
                         {
                             Unit *unit = new Unit();
-                            unit->Create(uguid);
+                            unit->Create(uguid, _fieldlayout);
                             objmgr.Add(unit);
                             logdebug("Created Unit with guid "I64FMT,uguid);
                             break;
@@ -137,7 +140,7 @@ void WorldSession::_HandleUpdateObjectOpcode(WorldPacket& recvPacket)
                             if(GetGuid() == uguid) // objmgr.Add() would cause quite some trouble if we added ourself again
                                 break;
                             Player *player = new Player();
-                            player->Create(uguid);
+                            player->Create(uguid, _fieldlayout);
                             objmgr.Add(player);
                             logdebug("Created Player with guid "I64FMT,uguid);
                             break;
@@ -145,7 +148,7 @@ void WorldSession::_HandleUpdateObjectOpcode(WorldPacket& recvPacket)
                     case TYPEID_GAMEOBJECT:
                         {
                             GameObject *go = new GameObject();
-                            go->Create(uguid);
+                            go->Create(uguid, _fieldlayout);
                             objmgr.Add(go);
                             logdebug("Created GO with guid "I64FMT,uguid);
                             break;
@@ -153,7 +156,7 @@ void WorldSession::_HandleUpdateObjectOpcode(WorldPacket& recvPacket)
                     case TYPEID_CORPSE:
                         {
                             Corpse *corpse = new Corpse();
-                            corpse->Create(uguid);
+                            corpse->Create(uguid, _fieldlayout);
                             objmgr.Add(corpse);
                             logdebug("Created Corpse with guid "I64FMT,uguid);
                             break;
@@ -161,7 +164,7 @@ void WorldSession::_HandleUpdateObjectOpcode(WorldPacket& recvPacket)
                     case TYPEID_DYNAMICOBJECT:
                         {
                             DynamicObject *dobj = new DynamicObject();
-                            dobj->Create(uguid);
+                            dobj->Create(uguid, _fieldlayout);
                             objmgr.Add(dobj);
                             logdebug("Created DynObj with guid "I64FMT,uguid);
                             break;
@@ -244,7 +247,7 @@ void WorldSession::_HandleUpdateObjectOpcode(WorldPacket& recvPacket)
 
 void WorldSession::_MovementUpdate(uint8 objtypeid, uint64 uguid, WorldPacket& recvPacket)
 {
-    MovementInfo mi; // TODO: use a reference to a MovementInfo in Unit/Player class once implemented
+    MovementInfo mi(GetInstance()->GetConf()->client); // TODO: use a reference to a MovementInfo in Unit/Player class once implemented
     uint16 flags;
     uint8 flags_6005;
     // uint64 fullguid; // see below
@@ -451,16 +454,17 @@ void WorldSession::_ValuesUpdate(uint64 uguid, WorldPacket& recvPacket)
     {
         logcustom(1,LRED,"Got UpdateObject_Values for unknown object "I64FMT,uguid);
         tyid = GetTypeIdByGuid(uguid); // can cause problems with TYPEID_CONTAINER!!
-        valuesCount = GetValuesCountByTypeId(tyid);
+        valuesCount = GetValuesCountByTypeId(_fieldlayout, tyid);
     }
 
 
-    recvPacket >> blockcount;
+    ByteBufferReader rd(recvPacket);
+    blockcount = rd.Read<uint8>();
     masksize = blockcount << 2; // each sizeof(uint32) == <4> * sizeof(uint8) // 1<<2 == <4>
     UpdateMask umask;
     uint32 *updateMask = new uint32[blockcount];
     umask.SetCount(masksize);
-    recvPacket.read((uint8*)updateMask, masksize);
+    rd.Read((uint8*)updateMask, masksize);
     umask.SetMask(updateMask);
     //delete [] updateMask; // will be deleted at ~UpdateMask() !!!!
     logdev("ValuesUpdate TypeId=%u GUID="I64FMT" pObj=%X Blocks=%u Masksize=%u",tyid,uguid,obj,blockcount,masksize);
@@ -468,22 +472,29 @@ void WorldSession::_ValuesUpdate(uint64 uguid, WorldPacket& recvPacket)
     // the container fields is set, THEN we have a problem. this should never be the case; it can be fixed in a
     // more correct way if there is the need.
     // (-> valuesCount smaller then it should be might skip a few bytes and corrupt the packet)
+    bool watched = obj && !_fieldwatch.Empty() && _fieldwatch.Begin(obj);
+    uint32 setcount = 0;
+    for (uint32 i = 0; i < valuesCount; i++)
+        if (umask.GetBit(i))
+            setcount++;
+    rd.Need(setcount * sizeof(uint32)); // all values are there, no need to check each one
     for (uint32 i = 0; i < valuesCount; i++)
     {
         if (umask.GetBit(i))
         {
+            value = rd.Get<uint32>();
             if(obj)
             {
-                recvPacket >> value;
+                if(watched && obj->GetUInt32Value((uint16)i) != value)
+                    _fieldwatch.Changed(i, obj->GetUInt32Value((uint16)i));
                 obj->SetUInt32Value(i, value);  //It does not matter what type of value we are setting, just copy the bytes
                 DEBUG(logdev("%u %u",i,value));
             }
-            else
-            {
-                recvPacket >> value; // drop the value, since object doesnt exist (always 4 bytes)
-            }
+            // else drop the value, since object doesnt exist (always 4 bytes)
         }
     }
+    if(watched)
+        _fieldwatch.Dispatch(obj);
 }
 
 void WorldSession::_QueryObjectInfo(uint64 guid)
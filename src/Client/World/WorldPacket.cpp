@@ -1,5 +1,39 @@
-
 #include "WorldPacket.h"
 
+WorldPacketPool::WorldPacketPool()
+{
+    _allocs = 0;
+}
+
+WorldPacketPool::~WorldPacketPool()
+{
+    for(uint32 i = 0; i < _free.size(); i++)
+        delete _free[i];
+}
 
+// returns an empty packet with at least size bytes reserved
+WorldPacket *WorldPacketPool::Get(uint16 opcode, uint32 size)
+{
+    if(_free.empty())
+    {
+        _allocs++;
+        return new WorldPacket(opcode, size);
+    }
+    WorldPacket *pkt = _free.back();
+    _free.pop_back();
+    pkt->SetOpcode(opcode);
+    pkt->reserve(size);
+    return pkt;
+}
 
+// takes over a packet that is no longer needed. it does not have to come from this pool.
+void WorldPacketPool::Release(WorldPacket *pkt)
+{
+    if(_free.size() >= PACKETPOOL_MAX_FREE || pkt->capacity() > PACKETPOOL_MAX_CAPACITY)
+    {
+        delete pkt;
+        return;
+    }
+    pkt->clear(); // keeps the buffer's capacity
+    _free.push_back(pkt);
+}
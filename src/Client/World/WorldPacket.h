@@ -1,9 +1,13 @@
 #ifndef _WORLDPACKET_H
 #define _WORLDPACKET_H
 
+#include <vector>
 #include "SysDefs.h"
 #include "ByteBuffer.h"
 
+#define PACKETPOOL_MAX_FREE 128 // packets kept for reuse at most
+#define PACKETPOOL_MAX_CAPACITY (64*1024) // bigger buffers are not worth keeping around
+
 class WorldPacket : public ByteBuffer
 {
 public:
@@ -19,5 +23,21 @@ private:
 
 };
 
+// keeps handled packets together with their buffers, so that new ones can be filled
+// without going to the heap again. not threadsafe, only to be used by the thread that runs the WorldSession.
+class WorldPacketPool
+{
+public:
+    WorldPacketPool();
+    ~WorldPacketPool();
+    WorldPacket *Get(uint16 opcode, uint32 size);
+    void Release(WorldPacket *pkt);
+    inline uint32 GetAllocCount(void) { return _allocs; } // amount of packets that had to be newly allocated
+
+private:
+    std::vector<WorldPacket*> _free;
+    uint32 _allocs;
+};
+
 
 #endif
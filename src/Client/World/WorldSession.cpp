@@ -24,10 +24,6 @@ struct OpcodeHandler
     void (WorldSession::*handler)(WorldPacket& recvPacket);
 };
 
-uint32 Object::maxvalues[TYPEID_MAX];
-UpdateField Object::updatefields[UPDATEFIELDS_NAME_COUNT];
-uint8 MovementInfo::_c=CLIENT_UNKNOWN;
-
 WorldSession::WorldSession(PseuInstance *in)
 {
     logdebug("-> Starting WorldSession 0x%X from instance 0x%X",this,in); // should never output a null ptr
@@ -43,8 +39,14 @@ WorldSession::WorldSession(PseuInstance *in)
     _lag_ms = 0;
     //...
 
-    _SetupObjectFields();
-    MovementInfo::_c=in->GetConf()->client;
+    _fieldlayout = GetUpdateFieldLayout(in->GetConf()->client);
+    if(!_fieldlayout)
+    {
+        logerror("WorldSession: No update field layout for client %u, can't handle objects!", in->GetConf()->client);
+        _mustdie = true;
+    }
+    _fieldwatch.SetInstance(in);
+    _fieldwatch.SetLayout(_fieldlayout);
 
     in->GetScripts()->RunScriptIfExists("_onworldsessioncreate");
 
@@ -74,6 +76,7 @@ WorldSession::~WorldSession()
     _instance->GetScripts()->RunScriptIfExists("_onworldsessiondelete");
 
     logdebug("~WorldSession(): %u packets left unhandled, and %u delayed. deleting.",pktQueue.size(),delayedPktQueue.size());
+    logdebug("~WorldSession(): %u packets and %u object blocks had to be allocated in total",_pktpool.GetAllocCount(),Object::GetHeapAllocCount());
     WorldPacket *packet;
     // clear the queue
     while(pktQueue.size())
@@ -107,15 +110,19 @@ void WorldSession::SetMustDie(void)
 void WorldSession::Start(void)
 {
     log("Connecting to '%s' on port %u",GetInstance()->GetConf()->worldhost.c_str(),GetInstance()->GetConf()->worldport);
+    _sh.EnableResolver(); // don't block on DNS, the name is looked up by the shared resolver thread
     _socket=new WorldSocket(_sh,this);
     _socket->Open(GetInstance()->GetConf()->worldhost,GetInstance()->GetConf()->worldport);
-    _sh.Add(_socket);
+    if(_socket->GetSocket() != INVALID_SOCKET) // else it is still being resolved and adds itself when done
+        _sh.Add(_socket);
 
     // if we cant connect, wait until the socket gives up (after 5 secs)
     while( (!MustDie()) && (!_socket->IsOk()) && (!GetInstance()->Stopped()) )
     {
         logdev("WorldSession::Start(): Socket not ok, waiting...");
         _sh.Select(3,0);
+        if(!_sh.GetCount()) // neither a lookup nor a connection attempt left, give up
+            SetMustDie();
         GetInstance()->Sleep(100);
     }
     logdev("WorldSession::Start() done, mustdie:%u, socket_ok:%u stopped:%u",MustDie(),_socket->IsOk(),GetInstance()->Stopped());
@@ -166,7 +173,7 @@ void WorldSession::Update(void)
     {
         WorldPacket *pkt = sendPktQueue.next();
         SendWorldPacket(*pkt);
-        delete pkt;
+        _pktpool.Release(pkt);
     }
 
     // while there are packets on the queue, handle them
@@ -277,7 +284,7 @@ void WorldSession::HandleWorldPacket(WorldPacket *packet)
             DumpPacket(*packet, packet->rpos(), "unknown exception");
     }
 
-    delete packet;
+    _pktpool.Release(packet);
 }
 
 
@@ -369,7 +376,7 @@ void WorldSession::_DelayWorldPacket(WorldPacket& pkt, uint32 ms)
 {
     DEBUG(logdebug("DelayWorldPacket (%s, size: %u, ms: %u)",GetOpcodeName(pkt.GetOpcode()),pkt.size(),ms));
     // need to copy the packet, because the current packet will be deleted after it got handled
-    WorldPacket *pktcopy = new WorldPacket(pkt.GetOpcode(),pkt.size());
+    WorldPacket *pktcopy = _pktpool.Get(pkt.GetOpcode(),pkt.size());
     pktcopy->append(pkt.contents(),pkt.size());
     delayedPktQueue.push_back(DelayedWorldPacket(pktcopy,ms));
     DEBUG(logdebug("-> WP ptr = 0x%X",pktcopy));
@@ -761,7 +768,7 @@ void WorldSession::EnterWorldWithCharacter(std::string name)
     // note: this is the only object that has to stay in memory unless its explicitly deleted by the server!
     // that means even if the server sends create object with that guid, do NOT recreate it!!
     MyCharacter *my = new MyCharacter();
-    my->Create(_myGUID);
+    my->Create(_myGUID, _fieldlayout);
     my->SetName(name);
     objmgr.Add(my);
 
@@ -853,14 +860,15 @@ void WorldSession::_HandleMessageChatOpcode(WorldPacket& recvPacket) //TODO: REW
     std::string source_name, listener_name;
     std::string msg, channel = "";
 
-    recvPacket >> type >> lang;
+    ByteBufferReader rd(recvPacket);
+    rd >> type >> lang;
 
     if(lang == LANG_ADDON && GetInstance()->GetConf()->skipaddonchat)
         return;
     if(GetInstance()->GetConf()->client > CLIENT_CLASSIC_WOW)
     {
-      recvPacket >> source_guid;
-      recvPacket >> unk32;
+      rd >> source_guid;
+      rd >> unk32;
     }
 
     switch(type)
@@ -873,26 +881,26 @@ void WorldSession::_HandleMessageChatOpcode(WorldPacket& recvPacket) //TODO: REW
         case CHAT_MSG_RAID_BOSS_WHISPER:
         case CHAT_MSG_RAID_BOSS_EMOTE:
         case CHAT_MSG_BN:
-            recvPacket >> source_name_len;
-            recvPacket >> source_name;
+            rd >> source_name_len;
+            rd >> source_name;
             // MaNGOS sends nothing for these, not used
-            recvPacket >> listener_guid; // always 0
+            rd >> listener_guid; // always 0
             if(listener_guid && !IS_PLAYER_GUID(listener_guid))
             {
-                recvPacket >> listener_name_len; // always 1 (\0)
-                recvPacket >> listener_name; // always \0
+                rd >> listener_name_len; // always 1 (\0)
+                rd >> listener_name; // always \0
                 logdebug("CHAT: Listener: '%s' (guid="I64FMT" len=%u type=%u)", listener_name.c_str(), listener_guid, listener_name_len, type);
             }
             break;
 
         default:
             if(type == CHAT_MSG_CHANNEL)
-                recvPacket >> channel;
-            recvPacket >> source_guid2; // no idea why it is sent twice
+                rd >> channel;
+            rd >> source_guid2; // no idea why it is sent twice
     }
-    recvPacket >> msglen;
-    recvPacket >> msg;
-    recvPacket >> chatTag;
+    rd >> msglen;
+    rd >> msg;
+    rd >> chatTag;
 
 
     SCPDatabase *langdb = GetDBMgr().GetDB("language");
@@ -1116,7 +1124,7 @@ void WorldSession::_HandleGroupInviteOpcode(WorldPacket& recvPacket)
 void WorldSession::_HandleMovementOpcode(WorldPacket& recvPacket)
 {
     uint64 guid;
-    MovementInfo mi;
+    MovementInfo mi(GetInstance()->GetConf()->client);
     guid = recvPacket.readPackGUID();
     recvPacket >> mi;
     DEBUG(logdebug("MOVE: "I64FMT" -> time=%u flags=0x%X x=%.4f y=%.4f z=%.4f o=%.4f",guid,mi.time,mi.flags,mi.pos.x,mi.pos.y,mi.pos.z,mi.pos.o));
@@ -1133,7 +1141,7 @@ void WorldSession::_HandleSetSpeedOpcode(WorldPacket& recvPacket)
     uint64 guid;
     float speed;
     uint32 movetype;
-    MovementInfo mi;
+    MovementInfo mi(GetInstance()->GetConf()->client);
 
     switch(recvPacket.GetOpcode())
     {
@@ -1257,7 +1265,7 @@ void WorldSession::_HandleTelePortAckOpcode(WorldPacket& recvPacket)
 {
     uint32 unk32;
     uint64 guid;
-    MovementInfo mi;
+    MovementInfo mi(GetInstance()->GetConf()->client);
     guid = recvPacket.readPackGUID();
     recvPacket >> unk32 >> mi;
 
@@ -1670,47 +1678,50 @@ void WorldSession::_HandleCreatureQueryResponseOpcode(WorldPacket& recvPacket)
     uint32 unk;
     float unkf;
     ct->entry = entry;
-    recvPacket >> ct->name;
-    recvPacket >> s;
-    recvPacket >> s;
-    recvPacket >> s;
-    recvPacket >> ct->subname;
+    ByteBufferReader rd(recvPacket);
+    rd >> ct->name;
+    rd >> s;
+    rd >> s;
+    rd >> s;
+    rd >> ct->subname;
     if(GetInstance()->GetConf()->client > CLIENT_CLASSIC_WOW)
-      recvPacket >> ct->directions;
-    recvPacket >> ct->flag1;
-    recvPacket >> ct->type;
-    recvPacket >> ct->family;
-    recvPacket >> ct->rank;
+      rd >> ct->directions;
+    rd >> ct->flag1;
+    rd >> ct->type;
+    rd >> ct->family;
+    rd >> ct->rank;
     if(GetInstance()->GetConf()->client > CLIENT_CLASSIC_WOW)
     {
       if(GetInstance()->GetConf()->client == CLIENT_WOTLK)
       {
+          rd.Need(MAX_KILL_CREDIT * sizeof(uint32));
           for(uint32 i = 0; i < MAX_KILL_CREDIT; i++)
-              recvPacket >> ct->killCredit[i];
+              ct->killCredit[i] = rd.Get<uint32>();
       }
-      recvPacket >> ct->displayid_A;
-      recvPacket >> ct->displayid_H;
-      recvPacket >> ct->displayid_AF;
-      recvPacket >> ct->displayid_HF;
-      recvPacket >> unkf;
-      recvPacket >> unkf;
-      recvPacket >> ct->RacialLeader;
+      rd >> ct->displayid_A;
+      rd >> ct->displayid_H;
+      rd >> ct->displayid_AF;
+      rd >> ct->displayid_HF;
+      rd >> unkf;
+      rd >> unkf;
+      rd >> ct->RacialLeader;
       if(GetInstance()->GetConf()->client == CLIENT_WOTLK)
       {
+          rd.Need(4 * sizeof(uint32));
           for(uint32 i = 0; i < 4; i++)
-              recvPacket >> ct->questItems[i];
-          recvPacket >> ct->movementId;
+              ct->questItems[i] = rd.Get<uint32>();
+          rd >> ct->movementId;
       }
     }
     else
     {
-      recvPacket >> unk;
-      recvPacket >> ct->PetSpellDataId;
-      recvPacket >> ct->displayid_A;
+      rd >> unk;
+      rd >> ct->PetSpellDataId;
+      rd >> ct->displayid_A;
       ct->displayid_H = ct->displayid_A;
       ct->displayid_AF = ct->displayid_A;
       ct->displayid_HF = ct->displayid_A;
-      recvPacket >> ct->civilian;
+      rd >> ct->civilian;
     }
     std::stringstream ss;
     ss << "Got info for creature " << entry << ":" << ct->name;
@@ -1741,27 +1752,30 @@ void WorldSession::_HandleGameobjectQueryResponseOpcode(WorldPacket& recvPacket)
 
     GameobjectTemplate *go = new GameobjectTemplate();
     go->entry = entry;
-    recvPacket >> go->type;
-    recvPacket >> go->displayId;
-    recvPacket >> go->name;
-    recvPacket >> other_names; // name1
-    recvPacket >> other_names; // name2
-    recvPacket >> other_names; // name3 (all unused)
+    ByteBufferReader rd(recvPacket);
+    rd >> go->type;
+    rd >> go->displayId;
+    rd >> go->name;
+    rd >> other_names; // name1
+    rd >> other_names; // name2
+    rd >> other_names; // name3 (all unused)
     if(GetInstance()->GetConf()->client > CLIENT_CLASSIC_WOW)
     {
-      recvPacket >> unks;
-      recvPacket >> go->castBarCaption;
-      recvPacket >> go->unk1;
+      rd >> unks;
+      rd >> go->castBarCaption;
+      rd >> go->unk1;
     }
+    rd.Need(GAMEOBJECT_DATA_FIELDS * sizeof(uint32));
     for(uint32 i = 0; i < GAMEOBJECT_DATA_FIELDS; i++)
-        recvPacket >> go->raw.data[i];
+        go->raw.data[i] = rd.Get<uint32>();
     if(GetInstance()->GetConf()->client > CLIENT_CLASSIC_WOW)
     {
-      recvPacket >> go->size;
+      rd >> go->size;
       if(GetInstance()->GetConf()->client > CLIENT_TBC)
       {
+        rd.Need(4 * sizeof(uint32));
         for(uint32 i = 0; i < 4; i++)
-          recvPacket >> go->questItems[i];
+          go->questItems[i] = rd.Get<uint32>();
       }
     }
     std::stringstream ss;
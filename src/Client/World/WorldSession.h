@@ -12,6 +12,8 @@
 #include "SharedDefines.h"
 #include "ObjMgr.h"
 #include "CacheHandler.h"
+#include "FieldWatch.h"
+#include "ZCompressor.h"
 #include "Opcodes.h"
 
 class WorldSocket;
@@ -83,6 +85,8 @@ public:
     inline Channel *GetChannels(void) { return _channels; }
     inline MyCharacter *GetMyChar(void) { ASSERT(_myGUID > 0); return (MyCharacter*)objmgr.GetObj(_myGUID); }
     inline World *GetWorld(void) { return _world; }
+    inline const UpdateFieldLayout *GetFieldLayout(void) { return _fieldlayout; }
+    inline FieldWatchMgr& GetFieldWatch(void) { return _fieldwatch; }
 
     std::string GetOrRequestPlayerName(uint64);
     std::string DumpPacket(WorldPacket& pkt, int errpos = -1, const char *errstr = NULL);
@@ -107,6 +111,7 @@ public:
     void SendCharCreate(std::string name, uint8 race, uint8 class_, uint8 gender=0, uint8 skin=0, uint8 face=0, uint8 hairstyle=0, uint8 haircolor=0, uint8 facial=0, uint8 outfit=0);
 
     void HandleWorldPacket(WorldPacket*);
+    inline WorldPacketPool& GetPacketPool(void) { return _pktpool; } // only for use from the session's own thread
 
     inline void DisableOpcode(uint16 opcode) { _disabledOpcodes[opcode] = true; }
     inline void EnableOpcode(uint16 opcode) { _disabledOpcodes[opcode] = false; }
@@ -126,7 +131,6 @@ private:
     void _DoTimedActions(void);
     void _DelayWorldPacket(WorldPacket&, uint32);
     void _HandleDelayedPackets(void);
-    void _SetupObjectFields(void);
 
     // Opcode Handlers
     void _HandleAuthChallengeOpcode(WorldPacket& recvPacket);
@@ -175,6 +179,10 @@ private:
 
     PseuInstance *_instance;
     WorldSocket *_socket;
+    const UpdateFieldLayout *_fieldlayout; // object value layout of our client version
+    FieldWatchMgr _fieldwatch;
+    WorldPacketPool _pktpool;
+    ZInflater _inflater; // for SMSG_COMPRESSED_UPDATE_OBJECT
     ZThread::LockedQueue<WorldPacket*,ZThread::FastMutex> pktQueue, sendPktQueue;
     DelayedPacketQueue delayedPktQueue;
     bool _logged,_mustdie; // world status
@@ -15,6 +15,11 @@ WorldSocket::WorldSocket(SocketHandler &h, WorldSession *s) : TcpSocket(h)
     //Dummy functions for unencrypted packets on WorldSocket
     pDecryptRecv = &AuthCrypt::DecryptRecvDummy;
     pEncryptSend = &AuthCrypt::EncryptSendDummy;
+
+    if(s->GetInstance()->GetConf()->client > CLIENT_TBC) //Funny, old sources have this in TBC already...
+        pReadHeader = &WorldSocket::_ReadHeader12340;
+    else
+        pReadHeader = &WorldSocket::_ReadHeader;
 }
 
 bool WorldSocket::IsOk(void)
@@ -58,6 +63,8 @@ void WorldSocket::OnRead()
         this->CloseAndDelete();
         return;
     }
+    // all complete packets in the buffer are handled in this one call
+    WorldPacketPool& pool = GetSession()->GetPacketPool();
     while(ibuf.GetLength() > 0) // when all packets from the current ibuf are transformed into WorldPackets the remaining len will be zero
     {
 
@@ -70,10 +77,9 @@ void WorldSocket::OnRead()
                 break;
             }
             _gothdr=false;
-            WorldPacket *wp = new WorldPacket(_remaining);
+            WorldPacket *wp = pool.Get(_opcode,_remaining);
             wp->resize(_remaining);
             ibuf.Read((char*)wp->contents(),_remaining);
-            wp->SetOpcode(_opcode);
             GetSession()->AddToPktQueue(wp);
         }
         else // no pending header stored, so this packet must be a header
@@ -84,44 +90,7 @@ void WorldSocket::OnRead()
                 break;
             }
 
-            if(GetSession()->GetInstance()->GetConf()->client > CLIENT_TBC)//Funny, old sources have this in TBC already...
-            {
-              // read first byte and check if size is 3 or 2 bytes
-              uint8 firstSizeByte;
-              ibuf.Read((char*)&firstSizeByte, 1);
-              (_crypt.*pDecryptRecv)(&firstSizeByte, 1);
-              if (firstSizeByte & 0x80) // got large packet
-              {
-                  ServerPktHeaderBig hdr;
-                  ibuf.Read(((char*)&hdr) + 1, sizeof(ServerPktHeaderBig) - 1); // read *big* header, except first byte
-                  (_crypt.*pDecryptRecv)(((uint8*)&hdr) + 1, sizeof(ServerPktHeaderBig) - 1); // decrypt 2 of 3 bytes (first one already decrypted above) of size, and cmd
-                  hdr.size[0] = firstSizeByte; // assign missing first byte
-
-                  uint32 realsize = ((hdr.size[0]&0x7F) << 16) | (hdr.size[1] << 8) | hdr.size[2];
-                  _remaining = realsize - 2;
-                  _opcode = hdr.cmd;
-              }
-              else // "normal" packet
-              {
-                  ServerPktHeader hdr;
-                  ibuf.Read(((char*)&hdr) + 1, sizeof(ServerPktHeader) - 1); // read header, except first byte
-                  (_crypt.*pDecryptRecv)(((uint8*)&hdr) + 1, sizeof(ServerPktHeader) - 1); // decrypt all except first
-                  hdr.size |= firstSizeByte; // add already decrypted first byte
-
-                  _remaining = ntohs(hdr.size) - 2;
-                  _opcode = hdr.cmd;
-              }
-            }
-            else
-            {
-              ServerPktHeader hdr;
-              ibuf.Read(((char*)&hdr), sizeof(ServerPktHeader)); // read header
-              (_crypt.*pDecryptRecv)(((uint8*)&hdr), sizeof(ServerPktHeader)); // decrypt all
-
-              _remaining = ntohs(hdr.size) - 2;
-              _opcode = hdr.cmd;
-
-            }
+            (this->*pReadHeader)();
 
             if(_opcode > MAX_OPCODE_ID)
             {
@@ -135,8 +104,7 @@ void WorldSocket::OnRead()
             // the header is fine, now check if there are more data
             if(_remaining == 0) // this is a packet with no data (like CMSG_NULL_ACTION)
             {
-                WorldPacket *wp = new WorldPacket;
-                wp->SetOpcode(_opcode);
+                WorldPacket *wp = pool.Get(_opcode,0);
                 GetSession()->AddToPktQueue(wp);
             }
             else // there is a data part to fetch
@@ -147,6 +115,45 @@ void WorldSocket::OnRead()
     }
 }
 
+void WorldSocket::_ReadHeader12340(void)
+{
+    // read first byte and check if size is 3 or 2 bytes
+    uint8 firstSizeByte;
+    ibuf.Read((char*)&firstSizeByte, 1);
+    (_crypt.*pDecryptRecv)(&firstSizeByte, 1);
+    if (firstSizeByte & 0x80) // got large packet
+    {
+        ServerPktHeaderBig hdr;
+        ibuf.Read(((char*)&hdr) + 1, sizeof(ServerPktHeaderBig) - 1); // read *big* header, except first byte
+        (_crypt.*pDecryptRecv)(((uint8*)&hdr) + 1, sizeof(ServerPktHeaderBig) - 1); // decrypt 2 of 3 bytes (first one already decrypted above) of size, and cmd
+        hdr.size[0] = firstSizeByte; // assign missing first byte
+
+        uint32 realsize = ((hdr.size[0]&0x7F) << 16) | (hdr.size[1] << 8) | hdr.size[2];
+        _remaining = realsize - 2;
+        _opcode = hdr.cmd;
+    }
+    else // "normal" packet
+    {
+        ServerPktHeader hdr;
+        ibuf.Read(((char*)&hdr) + 1, sizeof(ServerPktHeader) - 1); // read header, except first byte
+        (_crypt.*pDecryptRecv)(((uint8*)&hdr) + 1, sizeof(ServerPktHeader) - 1); // decrypt all except first
+        hdr.size |= firstSizeByte; // add already decrypted first byte
+
+        _remaining = ntohs(hdr.size) - 2;
+        _opcode = hdr.cmd;
+    }
+}
+
+void WorldSocket::_ReadHeader(void)
+{
+    ServerPktHeader hdr;
+    ibuf.Read(((char*)&hdr), sizeof(ServerPktHeader)); // read header
+    (_crypt.*pDecryptRecv)(((uint8*)&hdr), sizeof(ServerPktHeader)); // decrypt all
+
+    _remaining = ntohs(hdr.size) - 2;
+    _opcode = hdr.cmd;
+}
+
 void WorldSocket::SendWorldPacket(WorldPacket &pkt)
 {
     if(!_ok)
@@ -156,11 +163,13 @@ void WorldSocket::SendWorldPacket(WorldPacket &pkt)
     hdr.size = ntohs(pkt.size()+4);
     hdr.cmd = pkt.GetOpcode();
     (_crypt.*pEncryptSend)((uint8*)&hdr, 6);
-    ByteBuffer final(pkt.size()+6);
-    final.append((uint8*)&hdr,sizeof(ClientPktHeader));
+    // build the packet right in the output queue's buffer, no more copies after this one
+    SendBuffer *buf = new SendBuffer(pkt.size()+sizeof(ClientPktHeader));
+    buf->Append((char*)&hdr,sizeof(ClientPktHeader));
     if(pkt.size())
-        final.append(pkt.contents(),pkt.size());
-    SendBuf((char*)final.contents(),final.size());
+        buf->Append((char*)pkt.contents(),pkt.size());
+    SendBuf(buf);
+    buf->Drop();
 }
 
 void WorldSocket::InitCrypt(BigNumber *k)
@@ -59,11 +59,15 @@ public:
     void InitCrypt(BigNumber *);
 
 private:
+    void _ReadHeader(void); // up to 2.4.3: 4 byte header, all of it encrypted
+    void _ReadHeader12340(void); // 3.3.5: 4 or 5 byte header, the first (encrypted) byte tells which one
+
     WorldSession *_session;
     AuthCrypt _crypt;
     void (AuthCrypt::*pInit)(BigNumber *);
     void (AuthCrypt::*pDecryptRecv)(uint8 *, size_t);
     void (AuthCrypt::*pEncryptSend)(uint8 *, size_t);
+    void (WorldSocket::*pReadHeader)(void); // picked once for the client version, not per packet
     bool _gothdr; // true if only the header was recieved yet
     uint16 _opcode; // stores the last recieved opcode
     uint32 _remaining; // bytes amount of the next data packet
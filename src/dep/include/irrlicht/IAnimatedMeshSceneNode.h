@@ -139,6 +139,9 @@ namespace scene
         //PSEUWOW
         //! Starts a M2 animation.
         virtual bool setM2Animation(u32 anim) = 0;
+        //! Plays looped M2 animations on the device clock instead of from the time they were started.
+        //! All nodes showing the same animation are then on the same frame. Off by default.
+        virtual void setM2GlobalClock(bool on) = 0;
         //PSEUWOW END
 
         //! Starts a default MD2 animation.
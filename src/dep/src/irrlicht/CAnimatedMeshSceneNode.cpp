@@ -42,7 +42,7 @@ CAnimatedMeshSceneNode::CAnimatedMeshSceneNode(IAnimatedMesh* mesh,
 	TransitionTime(0), Transiting(0.f), TransitingBlend(0.f),
 	JointMode(EJUOR_NONE), JointsUsed(false),
 	Looping(true), ReadOnlyMaterials(false), RenderFromIdentity(0),
-	LoopCallBack(0), PassCount(0), Shadow(0),
+	LoopCallBack(0), PassCount(0), Shadow(0), M2GlobalClock(false),
 	MD3Special ( 0 )
 {
 	#ifdef _DEBUG
@@ -245,6 +245,12 @@ void CAnimatedMeshSceneNode::OnAnimate(u32 timeMs)
 {
 	buildFrameNr(timeMs-LastTimeMs);
 
+	//PSEUWOW
+	// see setM2GlobalClock()
+	if (M2GlobalClock && Mesh && Mesh->getMeshType() == EAMT_M2 && Looping && FramesPerSecond > 0.f && EndFrame > StartFrame)
+		CurrentFrameNr = StartFrame + (f32)fmod((f64)timeMs * FramesPerSecond, (f64)(EndFrame-StartFrame));
+	//PSEUWOW END
+
 	if (Mesh)
 	{
 		scene::IMesh * mesh = getMeshForCurrentFrame();
@@ -724,6 +730,11 @@ bool CAnimatedMeshSceneNode::setM2Animation(u32 animID)
     setFrameLoop(begin, end);
     return true;
 }
+
+void CAnimatedMeshSceneNode::setM2GlobalClock(bool on)
+{
+    M2GlobalClock = on;
+}
 //PSEUWOW END
 
 //! Starts a MD2 animation.
@@ -102,6 +102,7 @@ namespace scene
         //PSEUWOW
         //! Starts a M2 animation.
         virtual bool setM2Animation(u32 anim);
+        virtual void setM2GlobalClock(bool on);
         //PSEUWOW
 
         //! Starts a MD2 animation.
@@ -203,6 +204,8 @@ namespace scene
 
 		IShadowVolumeSceneNode* Shadow;
 
+		bool M2GlobalClock; //PSEUWOW
+
 		core::array<IBoneSceneNode* > JointChildSceneNodes;
 		core::array<core::matrix4> PretransitingSave;
 
@@ -8,6 +8,7 @@
 #define OFFSET_WMOS 10
 
 #define ADT_MAXLAYERS 4
+#define CHUNKS_PER_TILE 256
 
 struct MHDR_chunk
 {
@@ -115,17 +115,22 @@ void AuthCrypt::DecryptRecv_6005(uint8 *data, size_t len)
     if (len < CRYPTED_RECV_LEN_6005)
         return;
 
+    // each byte depends on the previous one, so there is nothing to vectorize;
+    // keep the state in locals and wrap the key index without a division instead.
+    const uint8 *key = &_key[0];
+    const size_t keylen = _key.size();
+    size_t i = _recv_i;
+    uint8 j = _recv_j;
     for (size_t t = 0; t < CRYPTED_RECV_LEN_6005; t++)
     {
-        _recv_i %= _key.size();
-        uint8 x = (data[t] - _recv_j) ^ _key[_recv_i];
-        ++_recv_i;
-        _recv_j = data[t];
-        data[t] = x;
-
-
+        if (i >= keylen)
+            i = 0;
+        uint8 c = data[t];
+        data[t] = (c - j) ^ key[i++];
+        j = c;
     }
-
+    _recv_i = uint8(i);
+    _recv_j = j;
 }
 
 void AuthCrypt::EncryptSend_6005(uint8 *data, size_t len)
@@ -135,14 +140,18 @@ void AuthCrypt::EncryptSend_6005(uint8 *data, size_t len)
     if (len < CRYPTED_SEND_LEN_6005)
         return;
 
+    const uint8 *key = &_key[0];
+    const size_t keylen = _key.size();
+    size_t i = _send_i;
+    uint8 j = _send_j;
     for (size_t t = 0; t < CRYPTED_SEND_LEN_6005; t++)
     {
-        _send_i %= _key.size();
-        uint8 x = (data[t] ^ _key[_send_i]) + _send_j;
-        ++_send_i;
-        data[t] = _send_j = x;
+        if (i >= keylen)
+            i = 0;
+        data[t] = j = (data[t] ^ key[i++]) + j;
     }
-
+    _send_i = uint8(i);
+    _send_j = j;
 }
 
 void AuthCrypt::SetKey_6005(uint8 *key, size_t len)
@@ -173,14 +173,20 @@ class ByteBuffer
         ByteBuffer &operator>>(std::string& value)
         {
             value.clear();
-            while (true)
+            if(_rpos < size())
             {
-                char c=read<char>();
-                if (c==0)
-                    break;
-                value+=c;
+                const char *s = (const char*)&_storage[_rpos];
+                const char *z = (const char*)memchr(s, 0, size() - _rpos);
+                if(z)
+                {
+                    value.assign(s, z - s);
+                    _rpos += (z - s) + 1;
+                    return *this;
+                }
+                value.assign(s, size() - _rpos); // not terminated, fail like reading char by char would
+                _rpos = size();
             }
-            return *this;
+            throw ByteBufferException("read", _rpos, _wpos, sizeof(char), size());
         }
 
         uint8 operator[](size_t pos)
@@ -237,8 +243,10 @@ class ByteBuffer
         }
 
         const uint8 *contents() const { return &_storage[0]; };
+        uint8 *contents() { return &_storage[0]; }; // to fill a resize()d buffer in place
 
         inline size_t size() const { return _storage.size(); };
+        inline size_t capacity() const { return _storage.capacity(); };
 
         void resize(size_t newsize)
         {
@@ -272,24 +280,7 @@ class ByteBuffer
             if(buffer.size()) append(buffer.contents(),buffer.size());
         }
 
-        uint64 readPackGUID()
-        {
-            uint64 guid = 0;
-            uint8 guidmark = 0;
-            (*this) >> guidmark;
-
-            for(int i = 0; i < 8; ++i)
-            {
-                if(guidmark & (uint8(1) << i))
-                {
-                    uint8 bit;
-                    (*this) >> bit;
-                    guid |= (uint64(bit) << (i * 8));
-                }
-            }
-
-            return guid;
-        }
+        uint64 readPackGUID(); // see below
 
         void appendPackGUID(uint64 guid)
         {
@@ -466,6 +457,106 @@ class ByteBuffer
         std::vector<uint8> _storage;
 };
 
+// read-only view on the unread part of a ByteBuffer, for parsers that read lots of fields in a row.
+// Need() checks once that enough bytes are left and throws the same ByteBufferException the buffer would,
+// the Get functions after that do no checks at all. the Read functions and operator>> check for themselves.
+// the read position of the buffer is updated when the view goes out of scope.
+class ByteBufferReader
+{
+public:
+    ByteBufferReader(ByteBuffer& buf) : _buf(buf)
+    {
+        _start = buf.size() ? buf.contents() : NULL;
+        _end = _start + buf.size();
+        _p = _start + (buf.rpos() < buf.size() ? buf.rpos() : buf.size());
+    }
+    ~ByteBufferReader()
+    {
+        _buf.rpos(rpos());
+    }
+
+    inline size_t left(void) const { return _end - _p; }
+    inline size_t rpos(void) const { return _p - _start; }
+    inline void Need(size_t n) const
+    {
+        if(n > left())
+            throw ByteBufferException("read", rpos(), _buf.wpos(), n, _buf.size());
+    }
+
+    // unchecked
+    template <typename T> inline T Get(void)
+    {
+        T r;
+        memcpy(&r, _p, sizeof(T));
+        _p += sizeof(T);
+        return r;
+    }
+    inline void Get(uint8 *dest, size_t len)
+    {
+        memcpy(dest, _p, len);
+        _p += len;
+    }
+    inline void Skip(size_t len) { _p += len; }
+
+    // checked
+    template <typename T> inline T Read(void)
+    {
+        Need(sizeof(T));
+        return Get<T>();
+    }
+    inline void Read(uint8 *dest, size_t len)
+    {
+        Need(len);
+        Get(dest, len);
+    }
+    template <typename T> inline ByteBufferReader& operator>>(T& value)
+    {
+        value = Read<T>();
+        return *this;
+    }
+    inline ByteBufferReader& operator>>(std::string& value)
+    {
+        value = ReadCString();
+        return *this;
+    }
+
+    // zero-terminated string, the terminator is skipped
+    std::string ReadCString(void)
+    {
+        const char *s = (const char*)_p;
+        const char *z = (const char*)memchr(s, 0, left());
+        if(!z)
+            throw ByteBufferException("read", _buf.size(), _buf.wpos(), sizeof(char), _buf.size());
+        _p = (const uint8*)z + 1;
+        return std::string(s, z - s);
+    }
+
+    // mask byte, then one byte for every set bit in it
+    uint64 ReadPackGUID(void)
+    {
+        uint8 mask = Read<uint8>();
+        uint32 bytes = 0;
+        for(uint8 m = mask; m; m >>= 1)
+            bytes += m & 1;
+        Need(bytes);
+        uint64 guid = 0;
+        for(uint32 i = 0; i < 8; ++i)
+            if(mask & (1 << i))
+                guid |= uint64(*_p++) << (i * 8);
+        return guid;
+    }
+
+private:
+    ByteBuffer& _buf;
+    const uint8 *_start, *_end, *_p;
+};
+
+inline uint64 ByteBuffer::readPackGUID()
+{
+    ByteBufferReader r(*this);
+    return r.ReadPackGUID();
+}
+
 template <typename T> ByteBuffer &operator<<(ByteBuffer &b, std::vector<T> v)
 {
     b << (uint32)v.size();
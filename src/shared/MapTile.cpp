@@ -1,132 +1,612 @@
 #include "common.h"
+#include "zthread/Guard.h"
 #include "MapTile.h"
+#include "NavMesh.h"
 #include "log.h"
 #include "MemoryDataHolder.h"
+#include "MappedFile.h"
+
+// chunk ids as they appear in the specs; the files store them byte-reversed, so this is what reading them as uint32 gives
+#define ADT_FOURCC(a,b,c,d) ((uint32(a) << 24) | (uint32(b) << 16) | (uint32(c) << 8) | uint32(d))
+
+static inline uint32 ReadADTUint32(const uint8 *p)
+{
+    uint32 v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static void MCAL_decompress(const uint8 *inbuf, uint32 insize, uint8 *outbuf)
+{
+    /*
+    How the decompression works
+
+        * read a byte
+        * check for sign bit
+        * if set we are in fill mode else we are in copy mode
+        * take the 7 lesser bits of the first byte as a count indicator
+        o fill mode: read the next byte an fill it by count in resulting alpha map
+        o copy mode: read the next count bytes and copy them in the resulting alpha map
+        * if the alpha map is complete we are done otherwise start at 1. again
+    */
+    // 21-10-2008 by Flow
+    uint32 offI = 0; //offset IN buffer
+    uint32 offO = 0; //offset OUT buffer
+
+    // stop at the end of either buffer, a truncated or corrupt run must not read or write past them
+    while( offO < 4096 && offI < insize )
+    {
+        // fill or copy mode
+        bool fill = inbuf[offI] & 0x80;
+        unsigned n = inbuf[offI] & 0x7F;
+        offI++;
+        for( unsigned k = 0; k < n && offO < 4096 && offI < insize; k++ )
+        {
+            outbuf[offO] = inbuf[offI];
+            offO++;
+            if( !fill )
+                offI++;
+        }
+        if( fill ) offI++;
+    }
+    if( offO < 4096 )
+        memset(outbuf + offO, 0, 4096 - offO);
+}
+
+static inline float ReadADTFloat(const uint8 *p)
+{
+    float v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static inline bool IsValidFourCC(uint32 fcc)
+{
+    return isalnum((fcc >> 24) & 0xFF) && isalnum((fcc >> 16) & 0xFF) && isalnum((fcc >> 8) & 0xFF) && isalnum(fcc & 0xFF);
+}
+
+// one entry per 0-terminated string of a MTEX, MMDX or MWMO chunk
+static void ReadADTStringList(const uint8 *p, uint32 size, std::vector<std::string>& names)
+{
+    const char *s = (const char*)p, *end = s + size;
+    while(s < end)
+    {
+        const char *z = (const char*)memchr(s, 0, end - s);
+        if(!z)
+            z = end;
+        names.push_back(std::string(s, z - s));
+        s = z + 1;
+    }
+}
+
+static Doodad MakeDoodad(const MDDF_chunk& mddf, const std::string& mpqpath)
+{
+    Doodad d;
+    // and yet another coordinate system...
+    d.y = -(mddf.x - ZEROPOINT);
+    d.z = mddf.y;
+    d.x = -(mddf.z - ZEROPOINT);
+    d.ox = mddf.c;
+    d.oy = mddf.b;
+    d.oz = mddf.a;
+    d.flags = mddf.flags;
+    d.uniqueid = mddf.uniqueid;
+    d.MPQpath = mpqpath;
+    char fname[255];
+    MemoryDataHolder::MakeModelFilename(fname,mpqpath);
+    d.model = fname;
+    // this .mdx -> .m2 transformation is annoying >.< - replace "mdx" and end of string with "m2"
+    // d.model = d.model.substr(0, d.model.length() - 3) + "m2";
+    // 3.1.3 - no more .mdx in ADT
+    d.scale = mddf.scale / 1024.0f;
+    if(d.scale < 0.00001f)
+        d.scale = 1;
+    return d;
+}
+
+static WorldMapObject MakeWMO(const MODF_chunk& modf, const std::string& mpqpath)
+{
+    WorldMapObject wmo;
+    wmo.y = -(modf.x - ZEROPOINT);
+    wmo.z = modf.y;
+    wmo.x = -(modf.z - ZEROPOINT);
+    wmo.ox = modf.ox;
+    wmo.oy = modf.oy;
+    wmo.oz = modf.oz;
+    wmo.flags = modf.flags;
+    wmo.uniqueid = modf.uniqueid;
+    wmo.MPQpath = mpqpath;
+    char fname[255];
+    MemoryDataHolder::MakeWMOFilename(fname,mpqpath);
+    wmo.model = fname;
+    return wmo;
+}
 
 MapTile::MapTile()
 {
+    _detail = NULL;
+    _nav = NULL;
 }
 
 MapTile::~MapTile()
 {
+    UnloadDetail();
+    delete _nav;
 }
 
-void MapTile::ImportFromADT(ADTFile *adt)
+// single pass ADT parser, writes straight into the tile.
+// only the chunks needed for the parts selected by flags (MapTileLoadFlags) are looked at, the rest is skipped.
+bool MapTile::LoadFromADT(const uint8 *data, uint32 size, uint32 flags)
 {
+    std::vector<std::string> textures, models, wmos;
+    MapChunkDetail *detail = (flags & MAPTILE_LOAD_DETAIL) ? new MapChunkDetail[CHUNKS_PER_TILE] : NULL;
+    const uint8 *p = data, *end = data + size;
+    uint32 mcnkid = 0;
+    bool ok = true;
 
-    // import the height map
-    for(uint32 ch=0; ch<CHUNKS_PER_TILE; ch++)
+    if(flags & MAPTILE_LOAD_TERRAIN)
     {
-        _chunks[ch].baseheight = adt->_chunks[ch].hdr.zbase; // ADT files store (x/z) as ground coords and (y) as the height!
-        _chunks[ch].basex = adt->_chunks[ch].hdr.xbase; // here converting it to (x/y) on ground and basehight as actual height.
-        _chunks[ch].basey = adt->_chunks[ch].hdr.ybase; // strange coords they use... :S
-        _chunks[ch].lqheight = adt->_chunks[ch].waterlevel;
-        // extract heightmap
-        uint32 fcnt=0, rcnt=0;
-        while(true) //9*9 + 8*8
+        for(uint32 ch = 0; ch < CHUNKS_PER_TILE; ch++)
         {
-            for(uint32 h=0; h<9; h++)
-            {
-                _chunks[ch].hmap_rough[rcnt] = adt->_chunks[ch].vertices[fcnt+rcnt];
-                rcnt++;
-            }
-            if(rcnt+fcnt >= 145)
-                break;
-            for(uint32 h=0; h<8; h++)
-            {
-                _chunks[ch].hmap_fine[fcnt] = adt->_chunks[ch].vertices[fcnt+rcnt];
-                fcnt++;
-            }
+            _chunks[ch].haswater = false;
+            _chunks[ch].lqheight = 0;
         }
-        // extract water heightmap
-        for(uint32 i = 0; i < 81; i++)
-        {
-            _chunks[ch].hmap_lq[i] = adt->_chunks[ch].lqvertex[i].h;
-        }
-        // extract map layers with texture filenames
-        for(uint32 ly = 0; ly < adt->_chunks[ch].hdr.nLayers; ly++)
+    }
+
+    while(ok && end - p >= 8)
+    {
+        uint32 fcc = ReadADTUint32(p);
+        uint32 csize = ReadADTUint32(p + 4);
+        p += 8;
+        if(csize > uint32(end - p))
+            csize = end - p;
+        const uint8 *chunk = p;
+        p += csize;
+
+        switch(fcc)
         {
-            uint32 texoffs = adt->_chunks[ch].layer[ly].textureId;
-            char fname[255];
-            MemoryDataHolder::MakeTextureFilename(fname,adt->_textures[texoffs]);
-            _chunks[ch].texlayer.push_back(fname);
+            case ADT_FOURCC('M','C','I','N'):
+                for(uint32 i = 0; i < CHUNKS_PER_TILE && (i + 1) * sizeof(MCIN_chunk) <= csize; i++)
+                {
+                    if(!ReadADTUint32(chunk + i * sizeof(MCIN_chunk)))
+                    {
+                        logerror("MapTile: ADT chunk offset is NULL! Not loading.");
+                        ok = false;
+                        break;
+                    }
+                }
+                break;
+
+            case ADT_FOURCC('M','T','E','X'):
+                if(detail)
+                    ReadADTStringList(chunk, csize, textures);
+                break;
+
+            case ADT_FOURCC('M','M','D','X'):
+                if(flags & MAPTILE_LOAD_OBJECTS)
+                    ReadADTStringList(chunk, csize, models);
+                break;
+
+            case ADT_FOURCC('M','W','M','O'):
+                if(flags & MAPTILE_LOAD_OBJECTS)
+                    ReadADTStringList(chunk, csize, wmos);
+                break;
+
+            case ADT_FOURCC('M','D','D','F'):
+                if(flags & MAPTILE_LOAD_OBJECTS)
+                {
+                    uint32 n = csize / sizeof(MDDF_chunk);
+                    _doodads.reserve(_doodads.size() + n);
+                    for(uint32 i = 0; i < n; i++)
+                    {
+                        MDDF_chunk mddf;
+                        memcpy(&mddf, chunk + i * sizeof(MDDF_chunk), sizeof(MDDF_chunk));
+                        _doodads.push_back(MakeDoodad(mddf, mddf.id < models.size() ? models[mddf.id] : ""));
+                    }
+                }
+                break;
+
+            case ADT_FOURCC('M','O','D','F'):
+                if(flags & MAPTILE_LOAD_OBJECTS)
+                {
+                    uint32 n = csize / sizeof(MODF_chunk);
+                    _wmo_data.reserve(_wmo_data.size() + n);
+                    for(uint32 i = 0; i < n; i++)
+                    {
+                        MODF_chunk modf;
+                        memcpy(&modf, chunk + i * sizeof(MODF_chunk), sizeof(MODF_chunk));
+                        _wmo_data.push_back(MakeWMO(modf, modf.id < wmos.size() ? wmos[modf.id] : ""));
+                    }
+                }
+                break;
+
+            case ADT_FOURCC('M','H','2','O'):
+                // per chunk: ofsInformation, layerCount, ofsRender. each layer has a 24 byte information block:
+                // uint16 type, uint16 flags, float minheight, float maxheight, 4 uint8 rect, ofsMask, ofsHeightmap.
+                // the chunk's liquid level is the highest maxheight of its layers, offsets are relative to the MH2O data.
+                if(flags & MAPTILE_LOAD_TERRAIN)
+                    for(uint32 i = 0; i < CHUNKS_PER_TILE && (i + 1) * 12 <= csize; i++)
+                    {
+                        uint32 ofsinfo = ReadADTUint32(chunk + i * 12);
+                        uint32 layers = ReadADTUint32(chunk + i * 12 + 4);
+                        MapChunk& c = _chunks[i];
+                        c.haswater = layers != 0;
+                        for(uint32 l = 0; l < layers && ofsinfo <= csize && (csize - ofsinfo) / 24 > l; l++)
+                        {
+                            float lvl = ReadADTFloat(chunk + ofsinfo + l * 24 + 8);
+                            if(l == 0 || lvl > c.lqheight)
+                                c.lqheight = lvl;
+                        }
+                    }
+                break;
+
+            case ADT_FOURCC('M','C','N','K'):
+                if(mcnkid < CHUNKS_PER_TILE)
+                    ok = _LoadChunkFromADT(mcnkid, chunk, csize, flags, detail ? &detail[mcnkid] : NULL, textures);
+                mcnkid++;
+                break;
+
+            default:
+                if(!IsValidFourCC(fcc))
+                {
+                    logerror("MapTile: Error loading ADT file.");
+                    ok = false;
+                }
         }
+    }
 
-        memcpy(_chunks[ch].alphamap, adt->_chunks[ch].alphamap, adt->_chunks[ch].hdr.sizeAlpha - 8);
+    if(!ok)
+    {
+        delete [] detail;
+        return false;
+    }
 
-        /*
-        // extract alpha maps. in adt they are stored in 4-bit encoding, which makes 4096 entries in 64x32 values
-        for(uint32 al = 0; al < (adt->_chunks[ch].hdr.sizeAlpha - 8) / 2048; al++) // see comment in ADTFile.cpp when loading MCAL chunk for explanation
+    if(flags & MAPTILE_LOAD_TERRAIN)
+    {
+        _xbase = _chunks[0].basex;
+        _ybase = _chunks[0].basey;
+        _hbase = _chunks[0].baseheight;
+    }
+
+    if(detail)
+    {
+        ZThread::Guard<ZThread::FastMutex> g(_detailMutex);
+        if(_detail)
+            delete [] detail; // someone else was faster
+        else
+            _detail = detail;
+    }
+
+    return true;
+}
+
+// sub-chunks of one MCNK chunk
+bool MapTile::_LoadChunkFromADT(uint32 ch, const uint8 *p, uint32 size, uint32 flags, MapChunkDetail *d, std::vector<std::string>& textures)
+{
+    if(size < sizeof(ADTMapChunkHeader))
+    {
+        logerror("MapTile: ADT chunk %u too small",ch);
+        return false;
+    }
+    ADTMapChunkHeader hdr;
+    memcpy(&hdr, p, sizeof(hdr));
+    const uint8 *end = p + size;
+    p += sizeof(hdr);
+
+    MapChunk& c = _chunks[ch];
+    const bool terrain = flags & MAPTILE_LOAD_TERRAIN;
+    if(terrain)
+    {
+        c.baseheight = hdr.zbase; // ADT files store (x/z) as ground coords and (y) as the height!
+        c.basex = hdr.xbase; // here converting it to (x/y) on ground and basehight as actual height.
+        c.basey = hdr.ybase;
+        c.areaid = hdr.areaid;
+        c.holes = hdr.holes & 0xFFFF;
+    }
+
+    bool mcal_compressed = false;
+    if(d)
+    {
+        memset(d->normals, 0, sizeof(d->normals));
+        memset(d->hmap_lq, 0, sizeof(d->hmap_lq));
+        d->texlayer.clear();
+        d->alphamap.clear();
+    }
+
+    while(end - p >= 8)
+    {
+        uint32 fcc = ReadADTUint32(p);
+        uint32 msize = ReadADTUint32(p + 4);
+        p += 8;
+        const uint32 avail = end - p;
+        uint32 advance;
+
+        // HACKS to make it work properly
+        if(!msize && fcc == ADT_FOURCC('M','C','A','L'))
+            continue;
+        if(!msize && fcc == ADT_FOURCC('M','C','L','Q')) // size for MCLQ block is always 0
+            msize = hdr.sizeLiquid - 8; // but even the size in the header is somewhat wrong.. pfff
+        advance = msize;
+
+        switch(fcc)
         {
-            for(uint32 aly = 0; aly < 64; aly++)
-            {
-                for(uint32 alx = 0; alx < 32; alx++)
+            case ADT_FOURCC('M','C','V','T'):
+                if(terrain && avail >= 145 * sizeof(float))
                 {
-                    _chunks[ch].alphamap[al][aly*64 + (alx*2)]   = adt->_chunks[ch].alphamap[al][aly*64 + alx] & 0xF0; // first 4 bits
-                    _chunks[ch].alphamap[al][aly*64 + (alx*2)+1] = adt->_chunks[ch].alphamap[al][aly*64 + alx] & 0x0F; // second
+                    // 9 outer (rough), 8 inner (fine), 9 outer, ..., 9 outer
+                    const uint8 *v = p;
+                    for(uint32 row = 0; row < 9; row++)
+                    {
+                        for(uint32 h = 0; h < 9; h++, v += 4)
+                            c.hmap_rough[row * 9 + h] = ReadADTFloat(v);
+                        if(row == 8)
+                            break;
+                        for(uint32 h = 0; h < 8; h++, v += 4)
+                            c.hmap_fine[row * 8 + h] = ReadADTFloat(v);
+                    }
+                }
+                break;
+
+            case ADT_FOURCC('M','C','N','R'):
+                if(d && avail >= sizeof(d->normals))
+                    memcpy(d->normals, p, sizeof(d->normals));
+                if(msize == 0x1B3) // HACK: skip unk junk bytes
+                    advance += 0xD;
+                break;
+
+            case ADT_FOURCC('M','C','L','Y'):
+                if(d)
+                {
+                    uint32 nlayers = std::min<uint32>(std::min(msize, avail) / sizeof(MCLY_chunk), ADT_MAXLAYERS);
+                    for(uint32 ly = 0; ly < nlayers; ly++)
+                    {
+                        MCLY_chunk layer;
+                        memcpy(&layer, p + ly * sizeof(MCLY_chunk), sizeof(MCLY_chunk));
+                        if(layer.flags & 0x200)
+                            mcal_compressed = true;
+                        char fname[255];
+                        MemoryDataHolder::MakeTextureFilename(fname, layer.textureId < textures.size() ? textures[layer.textureId] : "");
+                        d->texlayer.push_back(fname);
+                    }
+                }
+                break;
+
+            case ADT_FOURCC('M','C','A','L'):
+                if(d)
+                {
+                    // we can NOT use hdr.nLayers here... so we use: (full block size - header size) / single block size
+                    uint32 alphalayers = hdr.sizeAlpha > 8 ? (hdr.sizeAlpha - 8) / 2048 : 0;
+                    alphalayers = std::min<uint32>(std::min<uint32>(alphalayers, ADT_MAXLAYERS), avail / 2048);
+                    d->alphamap.resize(alphalayers * 64*64);
+                    for(uint32 i = 0; i < alphalayers; i++)
+                    {
+                        uint8 alphamap[2048];
+                        memcpy(alphamap, p + i * 2048, 2048);
+                        uint8 *out = d->GetAlphamap(i);
+                        if(mcal_compressed)
+                        {
+                            MCAL_decompress(alphamap, sizeof(alphamap), out);
+                        }
+                        else
+                        {
+                            // 4 bits per value, 32 bytes per row
+                            for(uint32 aly = 0; aly < 64; aly++)
+                            {
+                                for(uint32 alx = 0; alx < 32; alx++)
+                                {
+                                    out[aly*64 + (alx*2)]   = alphamap[aly*32 + alx] & 0xF0; // first 4 bits
+                                    out[aly*64 + (alx*2)+1] = alphamap[aly*32 + alx] & 0x0F; // second
+                                }
+                            }
+                        }
+                    }
+                }
+                break;
+
+            case ADT_FOURCC('M','C','L','Q'): // MCLQ changed to MH2O chunk for whole ADT file
+                if(avail >= 4 && ReadADTUint32(p) == ADT_FOURCC('M','C','S','E'))
+                {
+                    // not present, next block read will be the MCSE block
+                    if(terrain)
+                        c.haswater = false;
+                    advance = 0;
+                }
+                else
+                {
+                    if(terrain && avail >= 4)
+                    {
+                        c.haswater = true;
+                        c.lqheight = ReadADTFloat(p);
+                    }
+                    // 2 floats, then 81 LiquidVertex and 64 flag bytes
+                    if(d && msize > 8 && avail >= 8 + 81 * sizeof(LiquidVertex))
+                        for(uint32 i = 0; i < 81; i++)
+                            d->hmap_lq[i] = ReadADTFloat(p + 8 + i * sizeof(LiquidVertex) + 4);
+                    advance = std::max<uint32>(msize, 8);
+                }
+                break;
+
+            case ADT_FOURCC('M','C','S','E'):
+                if(flags & MAPTILE_LOAD_OBJECTS)
+                {
+                    uint32 emm = std::min<uint32>(hdr.nSndEmitters, avail / sizeof(MCSE_chunk));
+                    for(uint32 i = 0; i < emm; i++)
+                    {
+                        MCSE_chunk se;
+                        memcpy(&se, p + i * sizeof(MCSE_chunk), sizeof(MCSE_chunk));
+                        _soundemm.push_back(se);
+                    }
+                }
+                return true; // always the last one we care about
+
+            default:
+                if(!IsValidFourCC(fcc))
+                {
+                    logerror("MapTile: Error loading ADT file (chunk %u error).",ch);
+                    return false;
                 }
-            }
         }
-        */
-    }
-
-    // copy over doodads and do some transformations
-    DEBUG(logdebug("%u doodads", adt->_doodadsp.size()));
-    for(uint32 i = 0; i < adt->_doodadsp.size(); i++)
-    {
-        Doodad d;
-        MDDF_chunk& mddf = adt->_doodadsp[i];
-        // and yet another coordinate system...
-        d.y = -(mddf.x - ZEROPOINT);
-        d.z = mddf.y;
-        d.x = -(mddf.z - ZEROPOINT);
-        d.ox = mddf.c;
-        d.oy = mddf.b;
-        d.oz = mddf.a;
-        d.flags = mddf.flags;
-        d.uniqueid = mddf.uniqueid;
-        d.MPQpath = adt->_models[mddf.id];
-        char fname[255];
-        MemoryDataHolder::MakeModelFilename(fname,adt->_models[mddf.id]);
-        d.model = fname;
-        // this .mdx -> .m2 transformation is annoying >.< - replace "mdx" and end of string with "m2"
-        // d.model = d.model.substr(0, d.model.length() - 3) + "m2";
-        // 3.1.3 - no more .mdx in ADT
-        d.scale = mddf.scale / 1024.0f;
-        if(d.scale < 0.00001f)
-            d.scale = 1;
-        _doodads.push_back(d);
-    }
-
-    // copy over wmos and do some transformations
-    DEBUG(logdebug("%u wmos", adt->_wmosp.size()));
-    for(uint32 i = 0; i < adt->_wmosp.size(); i++)
-    {
-        WorldMapObject wmo;
-        MODF_chunk& modf = adt->_wmosp[i];
-        wmo.y = -(modf.x - ZEROPOINT);
-        wmo.z = modf.y;
-        wmo.x = -(modf.z - ZEROPOINT);
-        wmo.ox = modf.ox;
-        wmo.oy = modf.oy;
-        wmo.oz = modf.oz;
-        wmo.flags = modf.flags;
-        wmo.uniqueid = modf.uniqueid;
-        wmo.MPQpath = adt->_wmos[modf.id];
-        char fname[255];
-        MemoryDataHolder::MakeWMOFilename(fname,adt->_wmos[modf.id]);
-        wmo.model = fname;
-        _wmo_data.push_back(wmo);
-    }
-
-    // copy sound emitters
-    _soundemm = adt->_soundemm;
+
+        if(advance >= avail)
+            break;
+        p += advance;
+    }
+    return true;
+}
+
+// one chunk in a terrain file. the heights of a chunk are stored as 16 bit steps above its lowest point,
+// that's less than 1 mm off for everything but the steepest cliffs.
+struct MapChunkTerrainRecord
+{
+    float basex, basey, baseheight, lqheight;
+    float hmin, hstep;
+    uint32 areaid;
+    uint16 holes;
+    uint8 haswater;
+    uint8 pad;
+    uint16 heights[9*9 + 8*8]; // rough, then fine
+};
+
+#define MAPTILE_TERRAIN_SIZE (8 + sizeof(MapChunkTerrainRecord) * CHUNKS_PER_TILE)
+
+bool MapTile::LoadTerrain(const char *fn)
+{
+    MappedFile mf;
+    if(!mf.Open(fn))
+        return false;
+    if(mf.Size() != MAPTILE_TERRAIN_SIZE || memcmp(mf.Data(), "PHMP", 4))
+    {
+        logerror("MapTile: '%s' is not a terrain file",fn);
+        return false;
+    }
+    uint32 version;
+    memcpy(&version, mf.Data() + 4, 4);
+    if(version != MAPTILE_TERRAIN_VERSION)
+    {
+        logerror("MapTile: '%s' has version %u, expected %u",fn,version,MAPTILE_TERRAIN_VERSION);
+        return false;
+    }
+
+    const uint8 *p = mf.Data() + 8;
+    for(uint32 ch = 0; ch < CHUNKS_PER_TILE; ch++, p += sizeof(MapChunkTerrainRecord))
+    {
+        MapChunkTerrainRecord r;
+        memcpy(&r, p, sizeof(r));
+        MapChunk& c = _chunks[ch];
+        c.basex = r.basex;
+        c.basey = r.basey;
+        c.baseheight = r.baseheight;
+        c.lqheight = r.lqheight;
+        c.areaid = r.areaid;
+        c.holes = r.holes;
+        c.haswater = r.haswater != 0;
+        for(uint32 i = 0; i < 9*9; i++)
+            c.hmap_rough[i] = r.hmin + r.heights[i] * r.hstep;
+        for(uint32 i = 0; i < 8*8; i++)
+            c.hmap_fine[i] = r.hmin + r.heights[9*9 + i] * r.hstep;
+    }
 
     _xbase = _chunks[0].basex;
     _ybase = _chunks[0].basey;
     _hbase = _chunks[0].baseheight;
+    return true;
+}
+
+bool MapTile::SaveTerrain(const char *fn)
+{
+    std::vector<uint8> buf(MAPTILE_TERRAIN_SIZE, 0);
+    uint32 version = MAPTILE_TERRAIN_VERSION;
+    memcpy(&buf[0], "PHMP", 4);
+    memcpy(&buf[4], &version, 4);
+
+    uint8 *p = &buf[8];
+    for(uint32 ch = 0; ch < CHUNKS_PER_TILE; ch++, p += sizeof(MapChunkTerrainRecord))
+    {
+        MapChunk& c = _chunks[ch];
+        MapChunkTerrainRecord r;
+        memset(&r, 0, sizeof(r));
+        r.basex = c.basex;
+        r.basey = c.basey;
+        r.baseheight = c.baseheight;
+        r.lqheight = c.lqheight;
+        r.areaid = c.areaid;
+        r.holes = c.holes;
+        r.haswater = c.haswater ? 1 : 0;
+
+        float hmin = c.hmap_rough[0], hmax = c.hmap_rough[0];
+        for(uint32 i = 0; i < 9*9; i++)
+        {
+            hmin = std::min(hmin, c.hmap_rough[i]);
+            hmax = std::max(hmax, c.hmap_rough[i]);
+        }
+        for(uint32 i = 0; i < 8*8; i++)
+        {
+            hmin = std::min(hmin, c.hmap_fine[i]);
+            hmax = std::max(hmax, c.hmap_fine[i]);
+        }
+        r.hmin = hmin;
+        r.hstep = (hmax - hmin) / 65535.0f;
+        for(uint32 i = 0; i < 9*9 + 8*8; i++)
+        {
+            float h = i < 9*9 ? c.hmap_rough[i] : c.hmap_fine[i - 9*9];
+            r.heights[i] = r.hstep > 0 ? (uint16)std::min(65535.0f, (h - hmin) / r.hstep + 0.5f) : 0;
+        }
+        memcpy(p, &r, sizeof(r));
+    }
 
-    DEBUG(logdebug("MapTile first chunk base: h=%f x=%f y=%f",_hbase,_xbase,_ybase));
+    FILE *fh = fopen(fn, "wb");
+    if(!fh)
+        return false;
+    bool ok = fwrite(&buf[0], buf.size(), 1, fh) == 1;
+    fclose(fh);
+    return ok;
+}
+
+// load the rendering data from the source ADT file again
+bool MapTile::LoadDetail(void)
+{
+    {
+        ZThread::Guard<ZThread::FastMutex> g(_detailMutex);
+        if(_detail)
+            return true;
+    }
+    if(_sourcefile.empty())
+        return false;
+
+    MemoryDataHolder::MemoryDataResult mdr = MemoryDataHolder::GetFileBasic(_sourcefile);
+    if(!(mdr.flags & MemoryDataHolder::MDH_FILE_OK && mdr.data.size))
+    {
+        logerror("MapTile: Can't load details from '%s'",_sourcefile.c_str());
+        return false;
+    }
+    bool result = LoadFromADT((const uint8*)mdr.data.ptr, mdr.data.size, MAPTILE_LOAD_DETAIL);
+    MemoryDataHolder::Delete(_sourcefile);
+    if(!result)
+    {
+        logerror("MapTile: Error loading details from '%s'",_sourcefile.c_str());
+        return false;
+    }
+    DEBUG(logdebug("MapTile: Loaded details from '%s'",_sourcefile.c_str()));
+    return true;
+}
+
+void MapTile::UnloadDetail(void)
+{
+    ZThread::Guard<ZThread::FastMutex> g(_detailMutex);
+    if(_detail)
+    {
+        delete [] _detail;
+        _detail = NULL;
+    }
+}
+
+// rendering data is loaded on first use
+MapChunkDetail *MapTile::GetChunkDetail(uint32 x, uint32 y)
+{
+    if(!LoadDetail())
+        return NULL;
+    ZThread::Guard<ZThread::FastMutex> g(_detailMutex);
+    return _detail ? &_detail[y * 16 + x] : NULL; // NULL if unloaded again in the meantime
 }
 
 void MapTileStorage::_DebugDump(void)
@@ -145,41 +625,80 @@ void MapTileStorage::_DebugDump(void)
     printf(out.c_str());
 }
 
-// get approx Z position for world position (x,y).
-float MapTile::GetZ(float x, float y)
+// get the chunk containing world position (x,y), NULL if not on this tile
+MapChunk *MapTile::GetChunkAt(float x, float y)
 {
     float bx,by;
-    float real_z;
     bx = _chunks[0].basex; // world base coords of tile
     by = _chunks[0].basey;
     uint32 chx = (uint32)fabs((bx - x) / CHUNKSIZE); // get chunk id for given coords
     uint32 chy = (uint32)fabs((by - y) / CHUNKSIZE);
     if( chx > 15 || chy > 15)
     {
-        logerror("MapTile::GetZ() wrong chunk indexes (%d, %d) for (%f, %f)",chx,chy,x,y);
+        logerror("MapTile: wrong chunk indexes (%d, %d) for (%f, %f)",chx,chy,x,y);
         logerror(" - These coords are NOT on this tile!");
-        return INVALID_HEIGHT;
+        return NULL;
     }
-    MapChunk& ch = _chunks[chx*16 + chy];
-    uint32 vx,vy; // get vertex position (0,0) ... (8,8);
-    vy = (uint32)floor((fabs(ch.basey - y) / (CHUNKSIZE/16.0f)) + 0.5f);
-    if (vy % 2 == 0)
-    {
-        vx = (uint32)floor((fabs(ch.basex - x) / (CHUNKSIZE/8.0f)) + 0.5f);
-        real_z = ch.hmap_rough[vx*9 + (vy/2)] + ch.baseheight;
-    }
-    else if (vy % 2 != 0)
-    {
-        vx = (uint32)floor((fabs(ch.basex - x) / (CHUNKSIZE/7.0f)) ); //edit: removed + 0.5f
-        real_z = ch.hmap_fine[vx*8 + ((vy-1)/2)] + ch.baseheight;
-    }
-    if(vx > 8 || vy > 17)
+    return &_chunks[chx*16 + chy];
+}
+
+uint32 MapTile::GetAreaId(float x, float y)
+{
+    MapChunk *ch = GetChunkAt(x,y);
+    return ch ? ch->areaid : 0;
+}
+
+// get exact Z position for world position (x,y).
+float MapTile::GetZ(float x, float y)
+{
+    MapChunk *ch = GetChunkAt(x,y);
+    return ch ? ch->GetHeight(x,y) : INVALID_HEIGHT;
+}
+
+// get Z positions for many points at once. consecutive points are mostly on the same chunk,
+// so the chunk found for the previous point is tried first.
+void MapTile::GetZ(MapHeightQuery *q, uint32 count)
+{
+    MapChunk *ch = NULL;
+    for(uint32 i = 0; i < count; i++)
     {
-        logerror("MapTile::GetZ() wrong vertex indexes (%d, %d) for chunk (%d, %d) for (%f, %f) chunkpos (%f, %f) tile (%f, %f)",vx,vy,chx,chy,x,y,ch.basex,ch.basey,bx,by);
-        return INVALID_HEIGHT;
+        if(!ch || !ch->Contains(q[i].x, q[i].y))
+            ch = GetChunkAt(q[i].x, q[i].y);
+        q[i].z = ch ? ch->GetHeight(q[i].x, q[i].y) : INVALID_HEIGHT;
     }
+}
+
+// height of the terrain surface at world position (x,y), which must be on this chunk.
+// each of the 8x8 cells is made of 4 triangles, spanned by 2 outer (rough) vertices and the inner (fine)
+// vertex in the middle of the cell, the same way the client renders it.
+float MapChunk::GetHeight(float x, float y)
+{
+    float dx = (basex - x) / UNITSIZE; // the rough/fine row index goes along x, the column along y
+    float dy = (basey - y) / UNITSIZE;
+    int32 r = (int32)floor(dx);
+    int32 c = (int32)floor(dy);
+    if(r < 0) r = 0; else if(r > 7) r = 7;
+    if(c < 0) c = 0; else if(c > 7) c = 7;
+    float u = dx - r; // position inside the cell, 0..1
+    float v = dy - c;
+
+    float h00 = hmap_rough[r*9 + c];
+    float h01 = hmap_rough[r*9 + c + 1];
+    float h10 = hmap_rough[(r+1)*9 + c];
+    float h11 = hmap_rough[(r+1)*9 + c + 1];
+    float hc2 = hmap_fine[r*8 + c] * 2.0f; // center vertex, at (0.5, 0.5)
+    float h;
+
+    if(v <= u && v <= 1.0f - u) // triangle at the c edge
+        h = h00 + (h10 - h00) * u + (hc2 - h00 - h10) * v;
+    else if(v >= u && v >= 1.0f - u) // c+1 edge
+        h = h01 + (h11 - h01) * u + (hc2 - h01 - h11) * (1.0f - v);
+    else if(u <= v) // r edge
+        h = h00 + (h01 - h00) * v + (hc2 - h00 - h01) * u;
+    else // r+1 edge
+        h = h10 + (h11 - h10) * v + (hc2 - h10 - h11) * (1.0f - u);
 
-    return real_z;
+    return h + baseheight;
 }
 
 void MapTile::DebugDumpToFile(void)
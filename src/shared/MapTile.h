@@ -4,7 +4,7 @@
 #include <bitset>
 
 #include "WDTFile.h"
-#include "ADTFile.h"
+#include "ADTFileStructs.h"
 
 #define TILESIZE (533.33333f)
 #define CHUNKSIZE ((TILESIZE) / 16.0f)
@@ -12,19 +12,43 @@
 #define ZEROPOINT (32.0f * (TILESIZE))
 
 #define INVALID_HEIGHT -99999.0f
+#define MAPTILE_TERRAIN_VERSION 1 // increase this number whenever you change the terrain file format
 
-// individual chunks of a map
+class NavTile;
+
+// individual chunks of a map.
+// holds only what is needed for height, area and movement queries, everything that is
+// only used for rendering is in MapChunkDetail and loaded on demand.
 class MapChunk
 {
 public:
+    // cell (x,y) is (0,0) ... (7,7), each bit of the hole mask covers 2x2 cells
+    inline bool IsHole(uint32 cx, uint32 cy) { return holes & (1 << ((cy / 2) * 4 + (cx / 2))); }
+    // chunk covers (basex - CHUNKSIZE, basex] x (basey - CHUNKSIZE, basey], same as MapTile::GetChunkAt()
+    inline bool Contains(float x, float y)
+    {
+        return x <= basex && x > basex - CHUNKSIZE && y <= basey && y > basey - CHUNKSIZE;
+    }
+    float GetHeight(float x, float y);
+
     float hmap_rough[9*9];
     float hmap_fine[8*8];
-    float hmap[17*17]; // combined rough and fine hmap
     float basex,basey,baseheight,lqheight;
-    float hmap_lq[9*9]; // liquid (water, lava) height map
+    uint32 areaid;
+    uint16 holes;
+    bool haswater;
+};
+
+// texturing, lighting and liquid data of a chunk, only needed by the GUI
+struct MapChunkDetail
+{
+    inline uint32 GetAlphaLayerCount(void) { return alphamap.size() / (64*64); }
+    inline uint8 *GetAlphamap(uint32 layer) { return &alphamap[layer * 64*64]; }
+
     std::vector<std::string> texlayer;
-    uint8 alphamap[ADT_MAXLAYERS][64*64]; // TODO: make this a vector also
-    //... TODO: implement the rest of this
+    std::vector<uint8> alphamap; // 64*64 bytes per layer
+    NormalVector normals[9*9 + 8*8];
+    float hmap_lq[9*9]; // liquid (water, lava) height map
 };
 
 struct Doodad
@@ -45,6 +69,21 @@ struct WorldMapObject
     std::string MPQpath;
 };
 
+// one point of a batched height query. z is filled in, INVALID_HEIGHT if the point is not on a loaded tile.
+struct MapHeightQuery
+{
+    float x,y,z;
+};
+
+// parts of a MapTile to load from an ADT file
+enum MapTileLoadFlags
+{
+    MAPTILE_LOAD_TERRAIN = 0x01, // heights, holes, area ids, water levels
+    MAPTILE_LOAD_OBJECTS = 0x02, // doodads, WMOs, sound emitters
+    MAPTILE_LOAD_DETAIL  = 0x04, // normals, texture layers, alpha maps and liquid heights, see LoadDetail()
+    MAPTILE_LOAD_DEFAULT = MAPTILE_LOAD_TERRAIN | MAPTILE_LOAD_OBJECTS
+};
+
 // generic map tile class. stores the information previously stored in an ADT file
 // in an easier to use form.
 class MapTile
@@ -52,10 +91,22 @@ class MapTile
 public:
     MapTile();
     ~MapTile();
-    void ImportFromADT(ADTFile*);
+    bool LoadFromADT(const uint8 *data, uint32 size, uint32 flags = MAPTILE_LOAD_DEFAULT);
+    // compact terrain files generated by stuffextract, only what MAPTILE_LOAD_TERRAIN loads from the ADT
+    bool LoadTerrain(const char *fn);
+    bool SaveTerrain(const char *fn);
+    bool LoadDetail(void);
+    void UnloadDetail(void);
     float GetZ(float,float);
+    void GetZ(MapHeightQuery*,uint32);
+    uint32 GetAreaId(float,float);
     void DebugDumpToFile(void);
+    inline void SetSourceFile(std::string fn) { _sourcefile = fn; }
     inline MapChunk *GetChunk(uint32 x, uint32 y) { return &_chunks[y * 16 + x]; }
+    MapChunkDetail *GetChunkDetail(uint32 x, uint32 y);
+    MapChunk *GetChunkAt(float,float);
+    inline NavTile *GetNavTile(void) { return _nav; }
+    inline void SetNavTile(NavTile *nav) { _nav = nav; } // the tile takes ownership
     inline float GetBaseX(void) { return _xbase; }
     inline float GetBaseY(void) { return _ybase; }
     inline float GetBaseHeight(void) { return _hbase; }
@@ -67,10 +118,13 @@ public:
     inline WorldMapObject *GetWMO(uint32 i) { return &_wmo_data[i]; }
 
 private:
+    bool _LoadChunkFromADT(uint32 ch, const uint8 *p, uint32 size, uint32 flags, MapChunkDetail *d, std::vector<std::string>& textures);
+
     MapChunk _chunks[256]; // 16x16
-    std::vector<std::string> _textures;
-    std::vector<std::string> _wmos;
-    std::vector<std::string> _models;
+    MapChunkDetail *_detail; // 16x16, NULL until requested
+    NavTile *_nav; // NULL if there is no nav data for this tile
+    ZThread::FastMutex _detailMutex;
+    std::string _sourcefile; // ADT file to load the details from
     std::vector<Doodad> _doodads;
     std::vector<WorldMapObject> _wmo_data;
     std::vector<MCSE_chunk> _soundemm;
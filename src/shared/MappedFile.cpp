@@ -0,0 +1,80 @@
+#include "common.h"
+#include "MappedFile.h"
+
+#if PLATFORM != PLATFORM_WIN32
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+{
+    _ptr = NULL;
+    _size = 0;
+    _mapped = false;
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const char *fn)
+{
+    Close();
+#if PLATFORM != PLATFORM_WIN32
+    int fd = open(fn, O_RDONLY);
+    if(fd < 0)
+        return false;
+    struct stat st;
+    if(fstat(fd, &st) || !st.st_size)
+    {
+        close(fd);
+        return false;
+    }
+    void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping stays valid
+    if(p != MAP_FAILED)
+    {
+        _ptr = (uint8*)p;
+        _size = st.st_size;
+        _mapped = true;
+        return true;
+    }
+#endif
+    // no mmap() available or it failed, fall back to reading the file
+    uint32 size = GetFileSize(fn);
+    if(!size)
+        return false;
+    FILE *fh = fopen(fn, "rb");
+    if(!fh)
+        return false;
+    _ptr = new uint8[size];
+    if(fread(_ptr, 1, size, fh) != size)
+    {
+        fclose(fh);
+        delete [] _ptr;
+        _ptr = NULL;
+        return false;
+    }
+    fclose(fh);
+    _size = size;
+    _mapped = false;
+    return true;
+}
+
+void MappedFile::Close(void)
+{
+    if(!_ptr)
+        return;
+#if PLATFORM != PLATFORM_WIN32
+    if(_mapped)
+        munmap(_ptr, _size);
+    else
+#endif
+        delete [] _ptr;
+    _ptr = NULL;
+    _size = 0;
+    _mapped = false;
+}
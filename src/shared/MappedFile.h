@@ -0,0 +1,28 @@
+#ifndef _MAPPEDFILE_H
+#define _MAPPEDFILE_H
+
+#include "common.h"
+
+// read-only view of a whole file on disk.
+// uses mmap() where available, otherwise the file is read into memory in one go.
+class MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+    bool Open(const char *fn);
+    void Close(void);
+    inline const uint8 *Data(void) const { return _ptr; }
+    inline uint32 Size(void) const { return _size; }
+    inline bool IsOpen(void) const { return _ptr != NULL; }
+
+private:
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+    uint8 *_ptr;
+    uint32 _size;
+    bool _mapped;
+};
+
+#endif
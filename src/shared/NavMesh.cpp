@@ -0,0 +1,531 @@
+#include <queue>
+#include <map>
+#include <algorithm>
+#include "common.h"
+#include "log.h"
+#include "MappedFile.h"
+#include "NavMesh.h"
+
+#define NAV_CELLS_TOTAL (64 * NAV_CELLS_PER_TILE) // per side, whole map
+#define NAV_DIAGONAL 1.41421356f // length of a diagonal step
+
+const int32 NavTile::dirX[NAV_DIR_COUNT] = { 1, 1, 0, -1, -1, -1,  0,  1 };
+const int32 NavTile::dirY[NAV_DIR_COUNT] = { 0, 1, 1,  1,  0, -1, -1, -1 };
+
+// direction for a step of (dx, dy), index is (dx+1)*3 + (dy+1)
+static const uint8 stepDir[9] = { NAV_DIR_XN_YN, NAV_DIR_XN, NAV_DIR_XN_YP, NAV_DIR_YN, NAV_DIR_COUNT, NAV_DIR_YP, NAV_DIR_XP_YN, NAV_DIR_XP, NAV_DIR_XP_YP };
+
+// world coords of the center of a global cell, and the other way round
+static inline float CellToWorld(uint32 n) { return ZEROPOINT - (n + 0.5f) * NAV_CELLSIZE; }
+static inline bool WorldToCell(float f, uint32& n)
+{
+    float c = (ZEROPOINT - f) / NAV_CELLSIZE;
+    if(c < 0.0f || c >= float(NAV_CELLS_TOTAL))
+        return false;
+    n = uint32(c);
+    return true;
+}
+
+#define NAV_FOURCC(a,b,c,d) ((uint32(a) << 24) | (uint32(b) << 16) | (uint32(c) << 8) | uint32(d))
+#define WMO_GROUP_HEADER_SIZE 0x44 // MOGP header, the other chunks of a group file follow it inside the MOGP chunk
+#define WMO_TRI_DETAIL 0x04 // MOPY triangle flags
+#define WMO_TRI_COLLISION 0x08
+#define WMO_TRI_RENDER 0x20
+
+NavObstacles::NavObstacles(NavFileSource *src)
+{
+    _src = src;
+}
+
+void NavObstacles::ClearTriangles(void)
+{
+    _tris.clear();
+}
+
+// triangles of a WMO in model coords, NULL if it has none or could not be read
+std::vector<float> *NavObstacles::_GetModel(const std::string& mpqname)
+{
+    std::map<std::string, std::vector<float> >::iterator it = _models.find(mpqname);
+    if(it != _models.end())
+        return it->second.empty() ? NULL : &it->second;
+    std::vector<float>& tris = _models[mpqname]; // models that can't be read are remembered as well
+
+    // the root file only tells how many group files there are, the geometry is in the groups
+    ByteBuffer root;
+    if(mpqname.length() < 4 || !_src->GetFile(mpqname.c_str(), root) || !root.size())
+    {
+        logdebug("NavObstacles: could not read WMO '%s'",mpqname.c_str());
+        return NULL;
+    }
+    uint32 groups = 0;
+    const uint8 *p = root.contents(), *end = p + root.size();
+    while(end - p >= 8)
+    {
+        uint32 fcc, size;
+        memcpy(&fcc, p, 4);
+        memcpy(&size, p + 4, 4);
+        p += 8;
+        if(size > uint32(end - p))
+            break;
+        if(fcc == NAV_FOURCC('M','O','H','D') && size >= 8)
+        {
+            memcpy(&groups, p + 4, 4); // nMaterials, nGroups, ...
+            break;
+        }
+        p += size;
+    }
+
+    std::string base = mpqname.substr(0, mpqname.length() - 4);
+    for(uint32 g = 0; g < groups; g++)
+    {
+        char num[16];
+        sprintf(num, "_%03u.wmo", g);
+        std::string fn = base + num;
+        ByteBuffer group;
+        if(!_src->GetFile(fn.c_str(), group) || !group.size() || !_LoadGroup(group, tris))
+            logdebug("NavObstacles: could not read WMO group '%s'",fn.c_str());
+    }
+    return tris.empty() ? NULL : &tris;
+}
+
+// appends the collision triangles of a WMO group file
+bool NavObstacles::_LoadGroup(const ByteBuffer& data, std::vector<float>& tris)
+{
+    const uint8 *mopy = NULL, *movi = NULL, *movt = NULL;
+    uint32 nmopy = 0, nmovi = 0, nmovt = 0;
+    const uint8 *p = data.contents(), *end = p + data.size();
+    while(end - p >= 8)
+    {
+        uint32 fcc, size;
+        memcpy(&fcc, p, 4);
+        memcpy(&size, p + 4, 4);
+        p += 8;
+        if(fcc == NAV_FOURCC('M','O','G','P'))
+        {
+            if(end - p < WMO_GROUP_HEADER_SIZE)
+                return false;
+            p += WMO_GROUP_HEADER_SIZE;
+            continue;
+        }
+        if(size > uint32(end - p))
+            break;
+        if(fcc == NAV_FOURCC('M','O','P','Y')) // flags and material of each triangle
+        {
+            mopy = p;
+            nmopy = size / 2;
+        }
+        else if(fcc == NAV_FOURCC('M','O','V','I')) // 3 uint16 vertex indices per triangle
+        {
+            movi = p;
+            nmovi = size / 6;
+        }
+        else if(fcc == NAV_FOURCC('M','O','V','T')) // vertices, x y z with z up
+        {
+            movt = p;
+            nmovt = size / 12;
+        }
+        p += size;
+    }
+    if(!mopy || !movi || !movt)
+        return false;
+
+    for(uint32 t = 0; t < nmovi && t < nmopy; t++)
+    {
+        uint8 flags = mopy[t * 2];
+        bool render = (flags & WMO_TRI_RENDER) && !(flags & WMO_TRI_DETAIL);
+        if(!render && !(flags & WMO_TRI_COLLISION))
+            continue;
+        uint16 idx[3];
+        memcpy(idx, movi + t * 6, 6);
+        if(idx[0] >= nmovt || idx[1] >= nmovt || idx[2] >= nmovt)
+            continue;
+        for(uint32 v = 0; v < 3; v++)
+        {
+            float xyz[3];
+            memcpy(xyz, movt + idx[v] * 12, 12);
+            tris.insert(tris.end(), xyz, xyz + 3);
+        }
+    }
+    return true;
+}
+
+void NavObstacles::AddTile(MapTile *tile)
+{
+    for(uint32 i = 0; i < tile->GetWMOCount(); i++)
+    {
+        WorldMapObject *wmo = tile->GetWMO(i);
+        std::vector<float> *model = _GetModel(wmo->MPQpath);
+        if(!model)
+            continue;
+
+        // placed like SceneWorld places the WMO nodes: the model in irrlicht coords (x, z, y) is rotated by
+        // (-oz, -oy, -ox) degrees with irrlicht's rotation matrix, then moved to (-x, z, -y)
+        const float deg = 3.14159265f / 180.0f;
+        float cr = cos(-wmo->oz * deg), sr = sin(-wmo->oz * deg);
+        float cp = cos(-wmo->oy * deg), sp = sin(-wmo->oy * deg);
+        float cy = cos(-wmo->ox * deg), sy = sin(-wmo->ox * deg);
+        float m[9] = {
+            cp * cy,                  cp * sy,                  -sp,
+            sr * sp * cy - cr * sy,   sr * sp * sy + cr * cy,   sr * cp,
+            cr * sp * cy + sr * sy,   cr * sp * sy - sr * cy,   cr * cp
+        };
+        const std::vector<float>& mt = *model;
+        _tris.reserve(_tris.size() + mt.size());
+        for(uint32 v = 0; v < mt.size(); v += 3)
+        {
+            float ix = mt[v], iy = mt[v + 2], iz = mt[v + 1];
+            float ox = ix * m[0] + iy * m[3] + iz * m[6];
+            float oy = ix * m[1] + iy * m[4] + iz * m[7];
+            float oz = ix * m[2] + iy * m[5] + iz * m[8];
+            _tris.push_back(wmo->x - ox);
+            _tris.push_back(wmo->y - oz);
+            _tris.push_back(wmo->z + oy);
+        }
+    }
+}
+
+// marks the cells of a build grid (see NavTile::Build()) where the triangle is in the way of a walking character.
+// the triangle is sampled at half the cell size, that catches walls, which cover no area seen from above.
+static void BlockCells(const float *tri, uint32 gx, uint32 gy, const std::vector<float>& height, std::vector<uint8>& walkable)
+{
+    const uint32 side = NAV_CELLS_PER_TILE + 2;
+    // grid coords of the corners, the first index goes along world x
+    float ci[3], cj[3];
+    for(uint32 v = 0; v < 3; v++)
+    {
+        ci[v] = (ZEROPOINT - tri[v * 3]) / NAV_CELLSIZE - float(gy * NAV_CELLS_PER_TILE) + 1.0f;
+        cj[v] = (ZEROPOINT - tri[v * 3 + 1]) / NAV_CELLSIZE - float(gx * NAV_CELLS_PER_TILE) + 1.0f;
+    }
+    if(std::max(ci[0],std::max(ci[1],ci[2])) < 0.0f || std::min(ci[0],std::min(ci[1],ci[2])) >= float(side)
+        || std::max(cj[0],std::max(cj[1],cj[2])) < 0.0f || std::min(cj[0],std::min(cj[1],cj[2])) >= float(side))
+        return;
+
+    float len = 0.0f;
+    for(uint32 v = 0; v < 3; v++)
+    {
+        uint32 w = (v + 1) % 3;
+        float dx = tri[w * 3] - tri[v * 3], dy = tri[w * 3 + 1] - tri[v * 3 + 1], dz = tri[w * 3 + 2] - tri[v * 3 + 2];
+        len = std::max(len, sqrt(dx * dx + dy * dy + dz * dz));
+    }
+    uint32 steps = uint32(len / (NAV_CELLSIZE * 0.5f)) + 1;
+    for(uint32 a = 0; a <= steps; a++)
+    {
+        for(uint32 b = 0; a + b <= steps; b++)
+        {
+            float u = float(a) / steps, w = float(b) / steps;
+            float fi = ci[0] + (ci[1] - ci[0]) * u + (ci[2] - ci[0]) * w;
+            float fj = cj[0] + (cj[1] - cj[0]) * u + (cj[2] - cj[0]) * w;
+            if(fi < 0.0f || fj < 0.0f || fi >= float(side) || fj >= float(side))
+                continue;
+            uint32 c = uint32(fi) * side + uint32(fj);
+            if(!walkable[c])
+                continue;
+            float z = tri[2] + (tri[5] - tri[2]) * u + (tri[8] - tri[2]) * w;
+            if(z > height[c] + NAV_STEP_HEIGHT && z < height[c] + NAV_AGENT_HEIGHT)
+                walkable[c] = 0;
+        }
+    }
+}
+
+NavTile::NavTile()
+{
+    memset(_links, 0, sizeof(_links));
+}
+
+// create the links of tile (gx, gy) of the storage. the surrounding tiles should be loaded as well,
+// otherwise the cells at the tile border can not be connected to the neighbour tile.
+// obstacles, if given, are the WMO triangles on the tile.
+bool NavTile::Build(MapTileStorage *tiles, uint32 gx, uint32 gy, NavObstacles *obstacles)
+{
+    if(!tiles->GetTile(gx,gy))
+        return false;
+
+    // sample the cell centers, with a border of one cell from the neighbour tiles
+    const uint32 side = NAV_CELLS_PER_TILE + 2;
+    std::vector<float> height(side * side, INVALID_HEIGHT);
+    std::vector<uint8> walkable(side * side, 0);
+    for(uint32 i = 0; i < side; i++)
+    {
+        int32 nx = int32(gy * NAV_CELLS_PER_TILE + i) - 1; // the first index goes along world x, which is gy
+        if(nx < 0 || nx >= NAV_CELLS_TOTAL)
+            continue;
+        for(uint32 j = 0; j < side; j++)
+        {
+            int32 ny = int32(gx * NAV_CELLS_PER_TILE + j) - 1;
+            if(ny < 0 || ny >= NAV_CELLS_TOTAL)
+                continue;
+            MapTile *tile = tiles->GetTile(ny / NAV_CELLS_PER_TILE, nx / NAV_CELLS_PER_TILE);
+            if(!tile)
+                continue;
+            float x = CellToWorld(nx);
+            float y = CellToWorld(ny);
+            MapChunk *ch = tile->GetChunkAt(x,y);
+            if(!ch)
+                continue;
+            uint32 row = uint32((ch->basex - x) / UNITSIZE);
+            uint32 col = uint32((ch->basey - y) / UNITSIZE);
+            if(row > 7 || col > 7 || ch->IsHole(col,row))
+                continue;
+            float h = ch->GetHeight(x,y);
+            if(ch->haswater && ch->lqheight - h > NAV_MAX_WATER_DEPTH)
+                continue;
+            height[i * side + j] = h;
+            walkable[i * side + j] = 1;
+        }
+    }
+
+    if(obstacles)
+        for(uint32 t = 0; t < obstacles->GetTriangleCount(); t++)
+            BlockCells(obstacles->GetTriangle(t), gx, gy, height, walkable);
+
+    for(uint32 i = 0; i < NAV_CELLS_PER_TILE; i++)
+    {
+        for(uint32 j = 0; j < NAV_CELLS_PER_TILE; j++)
+        {
+            uint32 c = (i + 1) * side + (j + 1);
+            uint8 links = 0;
+            if(walkable[c])
+            {
+                for(uint32 d = 0; d < NAV_DIR_COUNT; d++)
+                {
+                    uint32 n = (i + 1 + dirX[d]) * side + (j + 1 + dirY[d]);
+                    if(!walkable[n])
+                        continue;
+                    bool diagonal = dirX[d] && dirY[d];
+                    // do not cut corners, both cells next to a diagonal step must be walkable too
+                    if(diagonal && !(walkable[(i + 1 + dirX[d]) * side + (j + 1)] && walkable[(i + 1) * side + (j + 1 + dirY[d])]))
+                        continue;
+                    float maxdiff = NAV_MAX_CLIMB * NAV_CELLSIZE * (diagonal ? NAV_DIAGONAL : 1.0f);
+                    if(fabs(height[n] - height[c]) <= maxdiff)
+                        links |= (1 << d);
+                }
+            }
+            _links[i * NAV_CELLS_PER_TILE + j] = links;
+        }
+    }
+    return true;
+}
+
+bool NavTile::Load(const char *fn)
+{
+    MappedFile mf;
+    if(!mf.Open(fn))
+        return false;
+    if(mf.Size() != 8 + sizeof(_links) || memcmp(mf.Data(), "PNAV", 4))
+    {
+        logerror("NavTile: '%s' is not a nav file",fn);
+        return false;
+    }
+    uint32 version;
+    memcpy(&version, mf.Data() + 4, 4);
+    if(version != NAVMESH_VERSION)
+    {
+        logerror("NavTile: '%s' has version %u, expected %u",fn,version,NAVMESH_VERSION);
+        return false;
+    }
+    memcpy(_links, mf.Data() + 8, sizeof(_links));
+    return true;
+}
+
+bool NavTile::Save(const char *fn)
+{
+    FILE *fh = fopen(fn, "wb");
+    if(!fh)
+        return false;
+    uint32 version = NAVMESH_VERSION;
+    bool ok = fwrite("PNAV", 4, 1, fh) == 1
+        && fwrite(&version, 4, 1, fh) == 1
+        && fwrite(_links, sizeof(_links), 1, fh) == 1;
+    fclose(fh);
+    return ok;
+}
+
+
+PathFinder::PathFinder(MapTileStorage *tiles)
+{
+    _tiles = tiles;
+}
+
+// links of a global cell, 0 if there is no nav data for it
+uint8 PathFinder::_GetLinks(uint32 nx, uint32 ny)
+{
+    MapTile *tile = _tiles->GetTile(ny / NAV_CELLS_PER_TILE, nx / NAV_CELLS_PER_TILE);
+    if(!tile || !tile->GetNavTile())
+        return 0;
+    return tile->GetNavTile()->GetLinks(nx % NAV_CELLS_PER_TILE, ny % NAV_CELLS_PER_TILE);
+}
+
+// true if the cells on the line from a to b are connected
+bool PathFinder::_LineWalkable(uint32 ax, uint32 ay, uint32 bx, uint32 by)
+{
+    int32 x = ax, y = ay;
+    int32 dx = abs(int32(bx) - x), dy = abs(int32(by) - y);
+    int32 sx = x < int32(bx) ? 1 : -1, sy = y < int32(by) ? 1 : -1;
+    int32 err = dx - dy;
+    while(x != int32(bx) || y != int32(by))
+    {
+        int32 e2 = err * 2, mx = 0, my = 0;
+        if(e2 > -dy)
+        {
+            err -= dy;
+            mx = sx;
+        }
+        if(e2 < dx)
+        {
+            err += dx;
+            my = sy;
+        }
+        if(!(_GetLinks(x,y) & (1 << stepDir[(mx + 1) * 3 + (my + 1)])))
+            return false;
+        x += mx;
+        y += my;
+    }
+    return true;
+}
+
+// state of a cell visited by the A* search
+struct NavSearchNode
+{
+    NavSearchNode() : cost(-1.0f), from(NAV_DIR_COUNT), closed(false) {}
+    float cost; // -1: not reached yet
+    uint8 from; // direction we came from
+    bool closed;
+};
+
+// A* from cell (snx, sny) to (enx, eny). only the bounding box of both cells, extended by margin, is searched.
+// only the visited cells are stored, and the search gives up after NAV_MAX_SEARCH_NODES of them,
+// so a large margin costs no more memory than the search actually needs.
+// cells receives the global cells of the path, as nx * NAV_CELLS_TOTAL + ny.
+bool PathFinder::_Search(uint32 snx, uint32 sny, uint32 enx, uint32 eny, uint32 margin, std::vector<uint32>& cells)
+{
+    uint32 x0 = std::min(snx,enx), x1 = std::max(snx,enx);
+    uint32 y0 = std::min(sny,eny), y1 = std::max(sny,eny);
+    x0 = x0 > margin ? x0 - margin : 0;
+    y0 = y0 > margin ? y0 - margin : 0;
+    x1 = std::min<uint32>(x1 + margin, NAV_CELLS_TOTAL - 1);
+    y1 = std::min<uint32>(y1 + margin, NAV_CELLS_TOTAL - 1);
+
+    typedef std::map<uint32,NavSearchNode> NodeMap; // global cell -> state
+    NodeMap nodes;
+    typedef std::pair<float,uint32> OpenEntry; // estimated total cost, global cell
+    std::priority_queue< OpenEntry, std::vector<OpenEntry>, std::greater<OpenEntry> > open;
+
+    uint32 start = snx * NAV_CELLS_TOTAL + sny;
+    uint32 end = enx * NAV_CELLS_TOTAL + eny;
+    nodes[start].cost = 0.0f;
+    open.push(OpenEntry(0.0f, start));
+    bool found = false;
+    uint32 visited = 0;
+    while(!open.empty())
+    {
+        uint32 cur = open.top().second;
+        open.pop();
+        NavSearchNode& curnode = nodes[cur];
+        if(curnode.closed)
+            continue;
+        if(cur == end)
+        {
+            found = true;
+            break;
+        }
+        if(++visited > NAV_MAX_SEARCH_NODES)
+        {
+            logdebug("PathFinder: search area exhausted after %u cells",visited);
+            break;
+        }
+        curnode.closed = true;
+        float curcost = curnode.cost;
+        uint32 cx = cur / NAV_CELLS_TOTAL, cy = cur % NAV_CELLS_TOTAL;
+        uint8 links = _GetLinks(cx, cy);
+        for(uint32 d = 0; d < NAV_DIR_COUNT; d++)
+        {
+            if(!(links & (1 << d)))
+                continue;
+            int32 nx = int32(cx) + NavTile::dirX[d], ny = int32(cy) + NavTile::dirY[d];
+            if(nx < int32(x0) || ny < int32(y0) || nx > int32(x1) || ny > int32(y1))
+                continue;
+            NavSearchNode& n = nodes[nx * NAV_CELLS_TOTAL + ny];
+            if(n.closed)
+                continue;
+            float c = curcost + ((NavTile::dirX[d] && NavTile::dirY[d]) ? NAV_DIAGONAL : 1.0f);
+            if(n.cost >= 0.0f && n.cost <= c)
+                continue;
+            n.cost = c;
+            n.from = d;
+            // octile distance to the end
+            float ddx = fabs(float(nx) - float(enx)), ddy = fabs(float(ny) - float(eny));
+            float est = std::max(ddx,ddy) + (NAV_DIAGONAL - 1.0f) * std::min(ddx,ddy);
+            open.push(OpenEntry(c + est, nx * NAV_CELLS_TOTAL + ny));
+        }
+    }
+    if(!found)
+        return false;
+
+    cells.clear();
+    for(uint32 c = end; ; )
+    {
+        cells.push_back(c);
+        if(c == start)
+            break;
+        uint8 d = nodes[c].from;
+        c = (c / NAV_CELLS_TOTAL - NavTile::dirX[d]) * NAV_CELLS_TOTAL + (c % NAV_CELLS_TOTAL - NavTile::dirY[d]);
+    }
+    std::reverse(cells.begin(), cells.end());
+    return true;
+}
+
+// find a path from (sx, sy) to (ex, ey). the path contains the end point and all points where the direction
+// changes, but not the start point. z is the terrain height at each point.
+// both points and the way between them must be on loaded tiles that have nav data.
+bool PathFinder::FindPath(float sx, float sy, float ex, float ey, std::vector<MapHeightQuery>& path)
+{
+    path.clear();
+    uint32 snx, sny, enx, eny;
+    if(!(WorldToCell(sx,snx) && WorldToCell(sy,sny) && WorldToCell(ex,enx) && WorldToCell(ey,eny)))
+        return false;
+    if(!_GetLinks(snx,sny) || !_GetLinks(enx,eny))
+    {
+        logdebug("PathFinder: no nav data at start (%f, %f) or end (%f, %f)",sx,sy,ex,ey);
+        return false;
+    }
+
+    // most paths are found close to the straight line, search a larger area only if needed
+    std::vector<uint32> cells;
+    for(uint32 margin = NAV_SEARCH_MARGIN; !_Search(snx,sny,enx,eny,margin,cells); margin *= 4)
+    {
+        if(margin >= NAV_MAX_SEARCH_MARGIN)
+        {
+            logdebug("PathFinder: no path from (%f, %f) to (%f, %f)",sx,sy,ex,ey);
+            return false;
+        }
+    }
+
+    // keep only the cells where the straight line to the next one is blocked
+    uint32 anchor = 0;
+    while(anchor + 1 < cells.size())
+    {
+        uint32 next = anchor + 1;
+        while(next + 1 < cells.size() && _LineWalkable(cells[anchor] / NAV_CELLS_TOTAL, cells[anchor] % NAV_CELLS_TOTAL,
+            cells[next + 1] / NAV_CELLS_TOTAL, cells[next + 1] % NAV_CELLS_TOTAL))
+            next++;
+        MapHeightQuery p;
+        p.x = CellToWorld(cells[next] / NAV_CELLS_TOTAL);
+        p.y = CellToWorld(cells[next] % NAV_CELLS_TOTAL);
+        path.push_back(p);
+        anchor = next;
+    }
+    if(path.empty()) // start and end are in the same cell
+        path.resize(1);
+    path.back().x = ex;
+    path.back().y = ey;
+
+    for(uint32 i = 0; i < path.size(); i++)
+    {
+        uint32 nx, ny;
+        WorldToCell(path[i].x,nx);
+        WorldToCell(path[i].y,ny);
+        MapTile *tile = _tiles->GetTile(ny / NAV_CELLS_PER_TILE, nx / NAV_CELLS_PER_TILE);
+        path[i].z = tile ? tile->GetZ(path[i].x,path[i].y) : INVALID_HEIGHT;
+    }
+    return true;
+}
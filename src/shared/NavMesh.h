@@ -0,0 +1,101 @@
+#ifndef NAVMESH_H
+#define NAVMESH_H
+
+#include <map>
+#include "MapTile.h"
+
+#define NAV_CELLS_PER_TILE 256 // per side, 16 per chunk, 2 per chunk unit
+#define NAV_CELLSIZE ((TILESIZE) / float(NAV_CELLS_PER_TILE))
+#define NAV_MAX_CLIMB 1.2f // max. height difference per yard that can be walked up or down
+#define NAV_MAX_WATER_DEPTH 1.5f // deeper water would make us swim, avoid it
+#define NAV_STEP_HEIGHT 0.5f // object geometry up to this height above the ground can be walked over
+#define NAV_AGENT_HEIGHT 2.0f // ... and above this height it can be walked under
+#define NAV_SEARCH_MARGIN 64 // cells a path may leave the bounding box of start and end, in the first try
+#define NAV_MAX_SEARCH_MARGIN 1024 // ... and in the last try
+#define NAV_MAX_SEARCH_NODES 65536 // cells a single search may visit, no matter how large the searched area is
+#define NAVMESH_VERSION 1 // increase this number whenever you change something that makes old files unusable
+
+// directions to the 8 neighbour cells, one bit each in the link mask of a cell.
+// (dx, dy) is the offset in global cell coords, both grow against the world x/y axes.
+enum NavDirection
+{
+    NAV_DIR_XP = 0, // (1, 0)
+    NAV_DIR_XP_YP,  // (1, 1)
+    NAV_DIR_YP,     // (0, 1)
+    NAV_DIR_XN_YP,  // (-1, 1)
+    NAV_DIR_XN,     // (-1, 0)
+    NAV_DIR_XN_YN,  // (-1, -1)
+    NAV_DIR_YN,     // (0, -1)
+    NAV_DIR_XP_YN,  // (1, -1)
+    NAV_DIR_COUNT
+};
+
+// where NavObstacles gets the WMO files from, stuffextract reads them from the MPQs
+class NavFileSource
+{
+public:
+    virtual ~NavFileSource() {}
+    virtual bool GetFile(const char *mpqname, ByteBuffer& data) = 0;
+};
+
+// collision triangles of the WMOs placed on a map tile, in world coords. the WMO geometry is read once
+// per model and kept, the same models are placed on many tiles.
+class NavObstacles
+{
+public:
+    NavObstacles(NavFileSource *src);
+    void AddTile(MapTile *tile); // adds all WMOs placed on the tile
+    void ClearTriangles(void); // the models stay loaded
+    inline uint32 GetTriangleCount(void) { return _tris.size() / 9; }
+    inline const float *GetTriangle(uint32 i) { return &_tris[i * 9]; }
+
+private:
+    std::vector<float> *_GetModel(const std::string& mpqname);
+    bool _LoadGroup(const ByteBuffer& data, std::vector<float>& tris);
+
+    NavFileSource *_src;
+    std::map<std::string, std::vector<float> > _models; // WMO file -> its triangles in model coords, 9 floats each
+    std::vector<float> _tris;
+};
+
+// walkability grid of one map tile. each cell stores which of its neighbours can be walked to,
+// based on terrain slope, holes and water depth. cells of a tile are (0,0) ... (255,255),
+// the first index goes along world x like the chunk rows of a MapTile.
+// cells where WMO geometry is in the way between NAV_STEP_HEIGHT and NAV_AGENT_HEIGHT above the ground
+// are not walkable, WMO floors are not walked on.
+// generated offline by stuffextract and loaded together with the MapTile it belongs to.
+class NavTile
+{
+public:
+    NavTile();
+    bool Build(MapTileStorage *tiles, uint32 gx, uint32 gy, NavObstacles *obstacles = NULL);
+    bool Load(const char *fn);
+    bool Save(const char *fn);
+    inline uint8 GetLinks(uint32 cx, uint32 cy) { return _links[cx * NAV_CELLS_PER_TILE + cy]; }
+    inline bool CanWalk(uint32 cx, uint32 cy, uint32 dir) { return GetLinks(cx,cy) & (1 << dir); }
+
+    static const int32 dirX[NAV_DIR_COUNT];
+    static const int32 dirY[NAV_DIR_COUNT];
+
+private:
+    uint8 _links[NAV_CELLS_PER_TILE * NAV_CELLS_PER_TILE];
+};
+
+// finds walkable paths over the NavTiles attached to the MapTiles of a MapTileStorage.
+// A* over the cell grid, the cell path is then shortened to the cells where the straight line
+// to the next one is blocked.
+class PathFinder
+{
+public:
+    PathFinder(MapTileStorage *tiles);
+    bool FindPath(float sx, float sy, float ex, float ey, std::vector<MapHeightQuery>& path);
+
+private:
+    uint8 _GetLinks(uint32 nx, uint32 ny);
+    bool _Search(uint32 snx, uint32 sny, uint32 enx, uint32 eny, uint32 margin, std::vector<uint32>& cells);
+    bool _LineWalkable(uint32 ax, uint32 ay, uint32 bx, uint32 by);
+
+    MapTileStorage *_tiles;
+};
+
+#endif
@@ -160,6 +160,12 @@ class ListenSocket : public Socket
                 return -1;
             }
             m_port = port;
+            if (!port)                            // find out what port was choosen
+            {
+                int sockaddr_length = sizeof(sockaddr);
+                getsockname(s, (struct sockaddr *)&sa, (socklen_t*)&sockaddr_length);
+                m_port = ntohs(sa.sin_port);
+            }
             m_depth = depth;
             Attach(s);
             return 0;
@@ -29,10 +29,24 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #include "ListenSocket.h"
 #include "ResolvSocket.h"
 #include "ResolvServer.h"
+#include <map>
+#include <time.h>
+#include "zthread/FastMutex.h"
+#include "zthread/Guard.h"
+
+struct ResolvCacheEntry
+{
+    ipaddr_t a;
+    time_t expire;
+};
+
+static ZThread::FastMutex s_cache_mutex;
+static std::map<std::string, ResolvCacheEntry> s_cache;
 
 ResolvServer::ResolvServer(port_t port)
 :Thread()
 ,m_quit(false)
+,m_ready(false)
 ,m_port(port)
 {
 }
@@ -51,9 +65,12 @@ void ResolvServer::Run()
 
     if (l.Bind("127.0.0.1", m_port))
     {
+        SetRunning(false);
         return;
     }
     h.Add(&l);
+    m_port = l.GetPort();                         // the one actually bound if any port was asked for
+    m_ready = true;
 
     while (!m_quit && IsRunning() )
     {
@@ -67,3 +84,28 @@ void ResolvServer::Quit()
 {
     m_quit = true;
 }
+
+
+bool ResolvServer::GetCached(const std::string& host, ipaddr_t& a)
+{
+    ZThread::Guard<ZThread::FastMutex> g(s_cache_mutex);
+    std::map<std::string, ResolvCacheEntry>::iterator it = s_cache.find(host);
+    if (it == s_cache.end())
+        return false;
+    if (it -> second.expire < time(NULL))
+    {
+        s_cache.erase(it);
+        return false;
+    }
+    a = it -> second.a;
+    return true;
+}
+
+
+void ResolvServer::AddCached(const std::string& host, ipaddr_t a)
+{
+    ZThread::Guard<ZThread::FastMutex> g(s_cache_mutex);
+    ResolvCacheEntry& e = s_cache[host];
+    e.a = a;
+    e.expire = time(NULL) + RESOLV_CACHE_TTL;
+}
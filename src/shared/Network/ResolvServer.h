@@ -23,16 +23,28 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #ifndef _RESOLVSERVER_H
 #define _RESOLVSERVER_H
 
+#include <string>
 #include "Thread.h"
+#include "socket_include.h"
+
+#define RESOLV_CACHE_TTL 300 // seconds a resolved address is reused without asking again
 
 class ResolvServer : public Thread
 {
     public:
+/** Listens on 127.0.0.1:port, port 0 picks a free one. */
         ResolvServer(port_t);
         ~ResolvServer();
 
         void Run();
         void Quit();
+/** True once the server listens for queries. */
+        bool Ready() { return m_ready; }
+        port_t GetPort() { return m_port; }
+
+/** Process-wide cache of resolved host names, shared by all SocketHandlers. */
+        static bool GetCached(const std::string& host, ipaddr_t& a);
+        static void AddCached(const std::string& host, ipaddr_t a);
 
     private:
         ResolvServer(const ResolvServer& )        // copy constructor
@@ -45,6 +57,7 @@ class ResolvServer : public Thread
         }
 
         bool m_quit;
-        port_t m_port;
+        volatile bool m_ready;
+        volatile port_t m_port;
 };
 #endif                                            // _RESOLVSERVER_H
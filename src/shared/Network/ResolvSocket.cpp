@@ -34,6 +34,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #endif
 */
 #include "ResolvSocket.h"
+#include "ResolvServer.h"
 #include "Utility.h"
 #include "Parse.h"
 
@@ -71,9 +72,16 @@ void ResolvSocket::OnLine(const std::string& line)
     {
         ipaddr_t l;
         u2ip(value, l);                           // ip2ipaddr_t
+        ResolvServer::AddCached(m_resolv_host, l);
         m_parent -> Resolved(m_resolv_id, l, m_resolv_port);
         m_parent = NULL;                          // always use first ip in case there are several
     }
+    else
+    if (line.empty() && m_parent)                 // end of answer without any address
+    {
+        m_parent -> Resolved(m_resolv_id, 0, m_resolv_port);
+        m_parent = NULL;
+    }
 }
 
 
@@ -130,6 +138,34 @@ void ResolvSocket::OnDetached()
 #endif                                        // _WIN32
     if (m_query == "gethostbyname")
     {
+#ifndef _WIN32
+// every query runs in its own detached thread, and gethostbyname() returns
+// static storage shared by all of them. getaddrinfo() is reentrant.
+// only the "A" lines are used by the client side, see OnLine()
+        struct addrinfo hints;
+        struct addrinfo *res = NULL;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;          // one entry per address, not per socket type
+        hints.ai_flags = AI_CANONNAME;
+        if (!getaddrinfo(m_data.c_str(), NULL, &hints, &res))
+        {
+            Send("Name: " + std::string(res -> ai_canonname ? res -> ai_canonname : m_data.c_str()) + "\n");
+            for (struct addrinfo *ai = res; ai; ai = ai -> ai_next)
+            {
+                const unsigned char *a = (const unsigned char *)&((struct sockaddr_in *)ai -> ai_addr) -> sin_addr;
+                char slask[40];
+                sprintf(slask, "A: %u.%u.%u.%u\n", a[0], a[1], a[2], a[3]);
+                Send( slask );
+            }
+            freeaddrinfo(res);
+        }
+        else
+        {
+            Send("Failed\n");
+        }
+#else
+// winsock keeps the returned hostent per thread
         struct hostent *h = gethostbyname(m_data.c_str());
         if (h)
         {
@@ -168,6 +204,7 @@ void ResolvSocket::OnDetached()
         {
             Send("Failed\n");
         }
+#endif                                        // _WIN32
         Send( "\n" );
     }
     else
@@ -35,6 +35,9 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #include "PoolSocket.h"
 #include "ResolvSocket.h"
 #include "ResolvServer.h"
+#include "zthread/FastMutex.h"
+#include "zthread/Guard.h"
+#include "zthread/Thread.h"
 
 #ifdef _DEBUG
 #define DEB(x) x
@@ -63,10 +66,12 @@ SocketHandler::SocketHandler(StdLog *p)
 }
 
 
+// one resolver thread for the whole process. it is never stopped, handlers come and go with every reconnect.
+static ZThread::FastMutex s_resolver_mutex;
+static ResolvServer *s_resolver = NULL;
+
 SocketHandler::~SocketHandler()
 {
-    if (m_resolver)
-        m_resolver -> Quit();
     if (!m_slave)
     {
         if(m_auto_close_sockets)
@@ -86,8 +91,6 @@ SocketHandler::~SocketHandler()
             }
         }
     }
-    if (m_resolver)
-        delete m_resolver;
 }
 
 
@@ -493,7 +496,7 @@ bool SocketHandler::OkToAccept()
 
 size_t SocketHandler::GetCount()
 {
-    return m_sockets.size();
+    return m_sockets.size() + m_add.size();       // sockets added while resolving are handled by the next Select()
 }
 
 
@@ -581,7 +584,6 @@ void SocketHandler::SetSocks4Userid(const std::string& id)
 
 int SocketHandler::Resolve(Socket *p,const std::string& host,port_t port)
 {
-// check cache
     ResolvSocket *resolv = new ResolvSocket(*this, p);
     resolv -> SetId(++m_resolv_id);
     resolv -> SetHost(host);
@@ -589,7 +591,7 @@ int SocketHandler::Resolve(Socket *p,const std::string& host,port_t port)
     resolv -> SetDeleteByHandler();
     ipaddr_t local;
     resolv -> u2ip("127.0.0.1", local);
-    if (!resolv -> Open(local, m_resolver_port))
+    if (!resolv -> Open(local, GetResolverPort()))
     {
         LogError(resolv, "Resolve", -1, "Can't connect to local resolve server", LOG_LEVEL_FATAL);
     }
@@ -600,9 +602,23 @@ int SocketHandler::Resolve(Socket *p,const std::string& host,port_t port)
 
 void SocketHandler::EnableResolver(port_t port)
 {
-    if (!m_resolver)
-    {
-        m_resolver_port = port;
-        m_resolver = new ResolvServer(port);
-    }
+    if (m_resolver)
+        return;
+    ZThread::Guard<ZThread::FastMutex> g(s_resolver_mutex);
+    if (!s_resolver)
+        s_resolver = new ResolvServer(port);
+    m_resolver = s_resolver;
+}
+
+
+// only once the resolver thread listens, queries sent before would find nobody to connect to
+bool SocketHandler::ResolverEnabled()
+{
+    return m_resolver && m_resolver -> Ready();
+}
+
+
+port_t SocketHandler::GetResolverPort()
+{
+    return m_resolver ? m_resolver -> GetPort() : 0;
 }
@@ -86,10 +86,14 @@ class SocketHandler
         bool Socks4TryDirect() { return m_bTryDirect; }
 
 /** Enable asynchronous DNS. */
-        void EnableResolver(port_t port = 16667);
-        bool ResolverEnabled() { return m_resolver ? true : false; }
+/** Use the resolver thread shared by all handlers of this process, it is started on first use.
+    Does not wait for the thread: until it listens, or if it could not bind its port, host names are
+    resolved synchronously. Port 0 (default) lets the system pick a free port, so several processes
+    on one host don't get in each other's way. */
+        void EnableResolver(port_t port = 0);
+        bool ResolverEnabled();
         int Resolve(Socket *,const std::string& host,port_t);
-        port_t GetResolverPort() { return m_resolver_port; }
+        port_t GetResolverPort();
 
         socket_m m_sockets;
     protected:
@@ -120,7 +124,6 @@ class SocketHandler
         bool m_bTryDirect;
         int m_resolv_id;
         ResolvServer *m_resolver;
-        port_t m_resolver_port;
         bool m_auto_close_sockets;
 };
 #endif                                            // _SOCKETHANDLER_H
@@ -29,6 +29,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #include <stdlib.h>
 #else
 #include <errno.h>
+#include <sys/uio.h>
 #endif
 #include <stdio.h>
 #include <fcntl.h>
@@ -41,6 +42,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #include "SocketHandler.h"
 #include "TcpSocket.h"
 #include "PoolSocket.h"
+#include "ResolvServer.h"
 
 #ifdef _DEBUG
 #define DEB(x) x
@@ -59,8 +61,8 @@ std::string TcpSocket::m_password;
 #endif
 TcpSocket::TcpSocket(SocketHandler& h) : Socket(h)
 ,ibuf(*this, TCP_BUFSIZE_READ)
-//,obuf(*this, 32768)
-,obuf(*this, 131070)
+,m_output_length(0)
+,m_bytes_queued(0)
 ,m_line("")
 ,m_socks4_state(0)
 ,m_resolver_id(0)
@@ -80,9 +82,10 @@ TcpSocket::TcpSocket(SocketHandler& h) : Socket(h)
 #ifdef _WIN32
 #pragma warning(disable:4355)
 #endif
-TcpSocket::TcpSocket(SocketHandler& h,size_t isize,size_t osize) : Socket(h)
+TcpSocket::TcpSocket(SocketHandler& h,size_t isize,size_t /*osize*/) : Socket(h)
 ,ibuf(*this, isize)
-,obuf(*this, osize)
+,m_output_length(0)
+,m_bytes_queued(0)
 ,m_line("")
 ,m_socks4_state(0)
 ,m_resolver_id(0)
@@ -105,6 +108,8 @@ TcpSocket::TcpSocket(SocketHandler& h,size_t isize,size_t osize) : Socket(h)
 
 TcpSocket::~TcpSocket()
 {
+    for (output_l::iterator it = m_obuf.begin(); it != m_obuf.end(); it++)
+        it -> buf -> Drop();
 #ifdef HAVE_OPENSSL
     if (m_ssl)
     {
@@ -218,15 +223,29 @@ bool TcpSocket::Open(ipaddr_t ip,port_t port,bool skip_socks)
 
 bool TcpSocket::Open(const std::string &host,port_t port)
 {
-    if (!Handler().ResolverEnabled() || isip(host) )
+    ipaddr_t l;
+    if (isip(host))
     {
-        ipaddr_t l;
         if (!u2ip(host,l))
         {
             return false;
         }
         return Open(l, port);
     }
+// looked up recently, by this or any other handler
+    if (ResolvServer::GetCached(host, l))
+    {
+        return Open(l, port);
+    }
+    if (!Handler().ResolverEnabled())
+    {
+        if (!u2ip(host,l))
+        {
+            return false;
+        }
+        ResolvServer::AddCached(host, l);
+        return Open(l, port);
+    }
 // resolve using async resolver thread
     m_resolver_id = Resolve(host, port);
     return true;
@@ -249,6 +268,7 @@ void TcpSocket::Resolved(int id,ipaddr_t a,port_t port)
         else
         {
             Handler().LogError(this, "Resolved", 0, "Resolver failed", LOG_LEVEL_FATAL);
+            OnConnectFailed();
         }
     }
     else
@@ -407,8 +427,10 @@ void TcpSocket::OnWrite()
         return;
 */
         DEB(        printf("TcpSocket(SSL)::OnWrite()\n");)
-// TODO: check MES buffer
-            int n = SSL_write(m_ssl,obuf.GetStart(),obuf.GetL());
+        if (m_obuf.empty())
+            return;
+        OutChunk& c = m_obuf.front();
+        int n = SSL_write(m_ssl,c.buf -> Data() + c.ptr,(int)(c.buf -> Size() - c.ptr));
         DEB(        printf("OnWrite: %d bytes sent\n",n);)
             if (n == -1)
         {
@@ -425,14 +447,14 @@ void TcpSocket::OnWrite()
         else
         {
             DEB(            printf(" %d bytes written\n",n);)
-                obuf.Remove(n);
+                RemoveOutput(n);
         }
         {
             bool br;
             bool bw;
             bool bx;
             Handler().Get(GetSocket(), br, bw, bx);
-            if (obuf.GetLength())
+            if (m_output_length)
                 Set(br, true);
             else
                 Set(br, false);
@@ -440,27 +462,40 @@ void TcpSocket::OnWrite()
         return;
 #endif                                    // HAVE_OPENSSL
     }
-/*
-    assert(GetSocket() != INVALID_SOCKET);
-    if (obuf.GetL() <= 0)
+    if (m_obuf.empty())
     {
-printf("OnWrite abort because: nothing to write\n");
-        Set(true, false);
+        bool br;
+        bool bw;
+        bool bx;
+        Handler().Get(GetSocket(), br, bw, bx);
+        Set(br, false);
         return;
     }
-    assert(obuf.GetL() > 0);
-    if (!Handler().Valid(this))
+// gather the queued chunks into one send call
+    int n;
+    size_t cnt = 0;
+#ifdef _WIN32
+    WSABUF iov[TCP_MAX_IOV];
+    for (output_l::iterator it = m_obuf.begin(); it != m_obuf.end() && cnt < TCP_MAX_IOV; it++, cnt++)
     {
-printf("OnWrite abort because: not valid\n");
-return;
-}
-if (!Ready())
-{
-printf("OnWrite abort because: not ready\n");
-return;
-}
-*/
-    int n = send(GetSocket(),obuf.GetStart(),(int)obuf.GetL(),MSG_NOSIGNAL);
+        iov[cnt].buf = it -> buf -> Data() + it -> ptr;
+        iov[cnt].len = (u_long)(it -> buf -> Size() - it -> ptr);
+    }
+    DWORD sent = 0;
+    n = WSASend(GetSocket(), iov, (DWORD)cnt, &sent, 0, NULL, NULL) ? -1 : (int)sent;
+#else
+    struct iovec iov[TCP_MAX_IOV];
+    for (output_l::iterator it = m_obuf.begin(); it != m_obuf.end() && cnt < TCP_MAX_IOV; it++, cnt++)
+    {
+        iov[cnt].iov_base = it -> buf -> Data() + it -> ptr;
+        iov[cnt].iov_len = it -> buf -> Size() - it -> ptr;
+    }
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = cnt;
+    n = (int)sendmsg(GetSocket(), &msg, MSG_NOSIGNAL);
+#endif
 /*
 When writing onto a connection-oriented socket that has been shut down (by the  local
 or the remote end) SIGPIPE is sent to the writing process and EPIPE is returned.  The
@@ -489,33 +524,14 @@ signal is not sent when the write call specified the MSG_NOSIGNAL flag.
     }
     else
     {
-        obuf.Remove(n);
-    }
-// check m_mes
-    while (obuf.Space() && m_mes.size())
-    {
-        ucharp_v::iterator it = m_mes.begin();
-        MES *p = *it;                             //m_mes[0];
-        if (obuf.Space() > p -> left())
-        {
-            obuf.Write(p -> curbuf(),p -> left());
-            delete p;
-//printf("\n m_mes erase()\n");
-            m_mes.erase(m_mes.begin());
-        }
-        else
-        {
-            size_t sz = obuf.Space();
-            obuf.Write(p -> curbuf(),sz);
-            p -> ptr += sz;
-        }
+        RemoveOutput(n);
     }
     {
         bool br;
         bool bw;
         bool bx;
         Handler().Get(GetSocket(), br, bw, bx);
-        if (obuf.GetLength())
+        if (m_output_length)
             Set(br, true);
         else
         {
@@ -526,6 +542,26 @@ signal is not sent when the write call specified the MSG_NOSIGNAL flag.
 }
 
 
+// drop n sent bytes from the front of the output queue
+void TcpSocket::RemoveOutput(size_t n)
+{
+    m_output_length -= n;
+    while (n && !m_obuf.empty())
+    {
+        OutChunk& c = m_obuf.front();
+        size_t left = c.buf -> Size() - c.ptr;
+        if (n < left)
+        {
+            c.ptr += n;
+            return;
+        }
+        n -= left;
+        c.buf -> Drop();
+        m_obuf.pop_front();
+    }
+}
+
+
 void TcpSocket::Send(const std::string &str)
 {
     SendBuf(str.c_str(),str.size());
@@ -534,7 +570,6 @@ void TcpSocket::Send(const std::string &str)
 
 void TcpSocket::SendBuf(const char *buf,size_t len)
 {
-    int n = (int)obuf.GetLength();
     if (!Ready())
     {
 // warning
@@ -549,41 +584,50 @@ void TcpSocket::SendBuf(const char *buf,size_t len)
             Handler().LogError(this, "SendBuf", 0, " * CloseAndDelete()", LOG_LEVEL_INFO);
         return;
     }
-//DEB(	printf("trying to send %d bytes;  buf before = %d bytes\n",len,n);)
-    if (m_mes.size() || len > obuf.Space())
+    if (!len)
+        return;
+//DEB(	printf("trying to send %d bytes;  buf before = %d bytes\n",len,m_output_length);)
+    bool was_empty = m_obuf.empty();
+// small writes go into the last chunk as long as it has room and nobody else holds a reference to it
+    if (!was_empty && !m_obuf.back().buf -> Shared() && m_obuf.back().buf -> Space() >= len)
     {
-        MES *p = new MES(buf,len);
-        m_mes.push_back(p);
+        m_obuf.back().buf -> Append(buf, len);
     }
-    if (m_mes.size())
+    else
     {
-        while (obuf.Space() && m_mes.size())
-        {
-            ucharp_v::iterator it = m_mes.begin();
-            MES *p = *it;                         //m_mes[0];
-            if (obuf.Space() > p -> left())
-            {
-                obuf.Write(p -> curbuf(),p -> left());
-                delete p;
-                m_mes.erase(m_mes.begin());
-            }
-            else
-            {
-                size_t sz = obuf.Space();
-                obuf.Write(p -> curbuf(),sz);
-                p -> ptr += sz;
-            }
-        }
+        OutChunk c;
+        c.buf = new SendBuffer(len > TCP_SEND_CHUNK ? len : TCP_SEND_CHUNK);
+        c.buf -> Append(buf, len);
+        c.ptr = 0;
+        m_obuf.push_back(c);
     }
-    else
+    m_output_length += len;
+    m_bytes_queued += (unsigned long)len;
+    if (was_empty)
     {
-        if (!obuf.Write(buf,len))
-        {
-            Handler().LogError(this, "SendBuf", -1, "Send overflow" );
-// overflow
-        }
+        OnWrite();
     }
-    if (!n)
+}
+
+
+void TcpSocket::SendBuf(SendBuffer *buf)
+{
+    if (!Ready())
+    {
+        Handler().LogError(this, "SendBuf", -1, "Attempt to write to a non-ready socket" );
+        return;
+    }
+    if (!buf -> Size())
+        return;
+    bool was_empty = m_obuf.empty();
+    OutChunk c;
+    c.buf = buf;
+    c.ptr = 0;
+    buf -> Grab();
+    m_obuf.push_back(c);
+    m_output_length += buf -> Size();
+    m_bytes_queued += (unsigned long)buf -> Size();
+    if (was_empty)
     {
         OnWrite();
     }
@@ -641,7 +685,8 @@ void TcpSocket::ReadLine()
 TcpSocket::TcpSocket(const TcpSocket& s)
 :Socket(s)
 ,ibuf(*this,0)
-,obuf(*this,0)
+,m_output_length(0)
+,m_bytes_queued(0)
 {
 }
 
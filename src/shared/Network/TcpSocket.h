@@ -25,6 +25,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 
 #include "Socket.h"
 #include "CircularBuffer.h"
+#include <deque>
 #ifdef HAVE_OPENSSL
 #include "openssl/ssl.h"
 #ifdef _WIN32
@@ -36,29 +37,46 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 #endif
 
 #define TCP_BUFSIZE_READ 131070
+#define TCP_SEND_CHUNK 4096                       // small writes are collected in chunks of at least this size
+#define TCP_MAX_IOV 64                            // max. chunks passed to one send call
+
+/** Reference counted block of outgoing data.
+    A caller that builds a packet anyway can queue it with TcpSocket::SendBuf(SendBuffer*)
+    instead of having it copied. Not thread safe, like the sockets using it. */
+class SendBuffer
+{
+    public:
+        SendBuffer(size_t capacity) : m_buf(new char[capacity]), m_capacity(capacity), m_size(0), m_refs(1) {}
+        void Grab() { m_refs++; }
+        void Drop() { if (!--m_refs) delete this; }
+        bool Shared() { return m_refs > 1; }
+        char *Data() { return m_buf; }
+        size_t Size() { return m_size; }
+        size_t Space() { return m_capacity - m_size; }
+        void Append(const char *p,size_t l) { memcpy(m_buf + m_size, p, l); m_size += l; }
+
+    private:
+        ~SendBuffer() { delete[] m_buf; }
+        SendBuffer(const SendBuffer& ) {}
+        SendBuffer& operator=(const SendBuffer& ) { return *this; }
+        char *m_buf;
+        size_t m_capacity;
+        size_t m_size;
+        int m_refs;
+};
 
 class TcpSocket : public Socket
 {
-    struct MES
+    struct OutChunk
     {
-        MES( const char *buf_in,size_t len_in)
-            :buf(new  char[len_in])
-            ,len(len_in)
-            ,ptr(0)
-        {
-            memcpy(buf,buf_in,len);
-        }
-        ~MES() { delete[] buf; }
-        size_t left() { return len - ptr; }
-        char *curbuf() { return buf + ptr; }
-        char *buf;
-        size_t len;
-        size_t ptr;
+        SendBuffer *buf;
+        size_t ptr;                               // bytes of buf already sent
     };
-    typedef std::list<MES *> ucharp_v;
+    typedef std::deque<OutChunk> output_l;
 
     public:
         TcpSocket(SocketHandler& );
+        /** osize is ignored, the output queue grows as needed. Kept for source compatibility. */
         TcpSocket(SocketHandler& ,size_t isize,size_t osize);
         ~TcpSocket();
 
@@ -75,16 +93,18 @@ class TcpSocket : public Socket
         //void Sendf(char const *format, ...);
 
         virtual void SendBuf(const char *,size_t);
+/** queue buf without copying it, the socket keeps its own reference */
+        void SendBuf(SendBuffer *buf);
         virtual void OnRawData(const char *,size_t) {}
 
         size_t GetInputLength() { return ibuf.GetLength(); }
-        size_t GetOutputLength() { return obuf.GetLength(); }
+        size_t GetOutputLength() { return m_output_length; }
 
         void ReadLine();
         virtual void OnLine(const std::string& );
 
         unsigned long GetBytesReceived() { return ibuf.ByteCounter(); }
-        unsigned long GetBytesSent() { return obuf.ByteCounter(); }
+        unsigned long GetBytesSent() { return m_bytes_queued; }
 
         void OnSocks4Connect();
         void OnSocks4ConnectFailed();
@@ -110,11 +130,14 @@ class TcpSocket : public Socket
         static  int password_cb(char *buf,int num,int rwflag,void *userdata);
 #endif
         bool SSLNegotiate();
+//
+        void RemoveOutput(size_t);
 //
         CircularBuffer ibuf;
-        CircularBuffer obuf;
+        output_l m_obuf;                          // sent with one gathering send() per writable event
+        size_t m_output_length;
+        unsigned long m_bytes_queued;
         std::string m_line;
-        ucharp_v m_mes;                           // overflow protection
 
     private:
         TcpSocket& operator=(const TcpSocket& ) { return *this; }
@@ -117,6 +117,51 @@ void ZCompressor::Inflate(void)
 
 }
 
+ZInflater::ZInflater()
+{
+    z_stream *zs = new z_stream;
+    memset(zs, 0, sizeof(z_stream));
+    zs->zalloc = (alloc_func)Z_NULL;
+    zs->zfree = (free_func)Z_NULL;
+    zs->opaque = (voidpf)Z_NULL;
+    _ready = inflateInit(zs) == Z_OK;
+    if(!_ready)
+        logerror("ZInflater: inflateInit failed!");
+    _stream = zs;
+}
+
+ZInflater::~ZInflater()
+{
+    if(_ready)
+        inflateEnd((z_stream*)_stream);
+    delete (z_stream*)_stream;
+}
+
+bool ZInflater::Inflate(const uint8 *src, uint32 srcsize, ByteBuffer& dst, uint32 realsize)
+{
+    if(!_ready || !srcsize || !realsize)
+        return false;
+
+    z_stream *zs = (z_stream*)_stream;
+    if(inflateReset(zs) != Z_OK)
+        return false;
+
+    dst.resize(realsize);
+    zs->next_in = (Bytef*)src;
+    zs->avail_in = srcsize;
+    zs->next_out = (Bytef*)dst.contents();
+    zs->avail_out = realsize;
+
+    int result = inflate(zs, Z_FINISH);
+    if(result != Z_STREAM_END || zs->total_out != realsize)
+    {
+        logerror("ZInflater: Inflate error! result=%d srcsize=%u outsize=%u realsize=%u",result,srcsize,(uint32)zs->total_out,realsize);
+        dst.clear();
+        return false;
+    }
+    return true;
+}
+
 void ZCompressor::clear(void)
 {
     ByteBuffer::clear();
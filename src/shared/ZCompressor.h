@@ -28,6 +28,21 @@ protected:
 
 
 
+};
+// inflate stream that is set up once and only reset for every buffer it decompresses.
+// for callers that inflate lots of small buffers, like the compressed update object packets.
+class ZInflater
+{
+public:
+    ZInflater();
+    ~ZInflater();
+    // decompresses src directly into dst, which is resized to realsize.
+    // returns false if the data did not inflate to exactly realsize bytes.
+    bool Inflate(const uint8 *src, uint32 srcsize, ByteBuffer& dst, uint32 realsize);
+
+private:
+    void *_stream; // z_stream, zlib.h is only included in the .cpp
+    bool _ready;
 };
 
 
@@ -6,8 +6,11 @@
 #include "tools.h"
 #include "MPQHelper.h"
 #include "dbcfile.h"
-#include "ADTFile.h"
+#include "ADTFileStructs.h"
 #include "WDTFile.h"
+#include "MapTile.h"
+#include "NavMesh.h"
+#include "MappedFile.h"
 #include "StuffExtract.h"
 #include "DBCFieldData.h"
 #include "MPQLocale.h"
@@ -27,7 +30,7 @@ std::set<NameAndAlt> soundFileSet;
 MPQHelper mpq;
 
 // default config; SCPs are done always
-bool doMaps=true, doSounds=false, doTextures=false, doWmos=false, doWmogroups=false, doModels=false, doMd5=true, doAutoclose=false;
+bool doMaps=true, doNavmesh=true, doTerrain=true, doSounds=false, doTextures=false, doWmos=false, doWmogroups=false, doModels=false, doMd5=true, doAutoclose=false;
 
 
 
@@ -97,6 +100,8 @@ void ProcessCmdArgs(int argc, char *argv[])
 
             what = argv[i]+1; // skip first byte (+/-)
             if     (!stricmp(what,"maps"))        doMaps = on;
+            else if(!stricmp(what,"navmesh"))     doNavmesh = on;
+            else if(!stricmp(what,"terrain"))     doTerrain = on;
             else if(!stricmp(what,"textures"))    doTextures = on;
             else if(!stricmp(what,"wmos"))        doWmos = on;
             else if(!stricmp(what,"wmogroups"))   doWmogroups = on;
@@ -127,6 +132,8 @@ void ProcessCmdArgs(int argc, char *argv[])
     // TODO: as soon as M2 model or WMO reading is done, extract those textures to, but independent from maps!!
     if(!doMaps)
     {
+        doNavmesh = false;
+        doTerrain = false;
         doWmos = false;
     }
     if(!doWmos)
@@ -146,6 +153,8 @@ void ProcessCmdArgs(int argc, char *argv[])
 void PrintConfig(void)
 {
     printf("config: Do maps:      %s\n",doMaps?"yes":"no");
+    printf("config: Do navmesh:   %s\n",doNavmesh?"yes":"no");
+    printf("config: Do terrain:   %s\n",doTerrain?"yes":"no");
     printf("config: Do textures:  %s\n",doTextures?"yes":"no");
     printf("config: Do wmos:      %s\n",doWmos?"yes":"no");
     printf("config: Do wmogroups: %s\n",doWmogroups?"yes":"no");
@@ -161,6 +170,8 @@ void PrintHelp(void)
     printf("Use + or - to turn a feature on or off.\n");
     printf("Features are:\n");
     printf("maps      - map extraction\n");
+    printf("navmesh   - build pathfinding data from the maps (requires maps extraction)\n");
+    printf("terrain   - write compact height/area files for use without GUI (requires maps extraction)\n");
     printf("textures  - extract textures\n");
     printf("wmos      - extract map WMOs (requires maps extraction)\n");
     printf("wmogroups - extract map WMO group files (requires maps and wmos extraction)\n");
@@ -175,7 +186,7 @@ void PrintHelp(void)
     printf("Examples:\n");
     printf("stuffextract +sounds +md5 -maps +autoclose -locale:enGB\n");
     printf("stuffextract +md5 -wmos -sounds -locale:auto -autoclose\n");
-    printf("\nDefault is: +maps -sounds -textures -wmos -models +md5 -autoclose\n");
+    printf("\nDefault is: +maps +navmesh +terrain -sounds -textures -wmos -models +md5 -autoclose\n");
 }
 
 
@@ -716,6 +727,17 @@ void ExtractMaps(void)
                         fh.close();
                         olddeps = texNames.size() + modelNames.size() + wmoNames.size();
 
+                        if(doTerrain)
+                        {
+                            char terrainfn[300];
+                            sprintf(terrainfn,MAPSDIR"/%u_%u_%u.hmp",it->first,x,y);
+                            MapTile tile;
+                            if(!tile.LoadFromADT(bb.contents(),bb.size(),MAPTILE_LOAD_TERRAIN))
+                                printf("ERROR: could not read terrain of %s\n",namebuf);
+                            else if(!tile.SaveTerrain(terrainfn))
+                                printf("ERROR: could not save file %s\n",terrainfn);
+                        }
+
                         if(doTextures) ADT_FillTextureData(bb.contents(),texNames);
                         if(doModels)   ADT_FillModelData(bb.contents(),modelNames);
                         if(doWmos)     ADT_FillWMOData(bb.contents(),wmoNames);
@@ -738,12 +760,84 @@ void ExtractMaps(void)
         }
         extrtotal+=extr;
         printf("\n");
+        if(doNavmesh && extr)
+            BuildNavTiles(it->first);
     }
 
     printf("\nDONE - %lu maps extracted, %u total dependencies.\n",extrtotal, texNames.size() + modelNames.size() + wmoNames.size());
     OutMD5(MAPSDIR,md5map);
 }
 
+// read an extracted ADT file into the storage, if it exists
+static void LoadNavSourceTile(MapTileStorage& tiles, uint32 mapid, uint32 x, uint32 y)
+{
+    char fn[300];
+    sprintf(fn,MAPSDIR"/%u_%u_%u.adt",mapid,x,y);
+    MappedFile mf;
+    if(x >= 64 || y >= 64 || tiles.GetTile(x,y) || !mf.Open(fn))
+        return;
+    MapTile *tile = new MapTile();
+    if(tile->LoadFromADT(mf.Data(),mf.Size(),MAPTILE_LOAD_TERRAIN | MAPTILE_LOAD_OBJECTS)) // terrain and the WMOs on it
+        tiles.SetTile(tile,x,y);
+    else
+        delete tile;
+}
+
+// the WMOs blocking nav cells are read straight from the MPQs, they need not be extracted
+class MPQNavFileSource : public NavFileSource
+{
+public:
+    bool GetFile(const char *mpqname, ByteBuffer& data)
+    {
+        if(!mpq.FileExists(mpqname))
+            return false;
+        data = mpq.ExtractFile(mpqname);
+        return true;
+    }
+};
+
+// build the walkability grids used for pathfinding from the extracted ADT files of a map and the WMOs on them.
+// a tile needs its neighbours to connect the cells at its border, so three rows of tiles are kept loaded.
+void BuildNavTiles(uint32 mapid)
+{
+    printf("Building navmesh for map %u...\n",mapid);
+    char fn[300];
+    uint32 built = 0;
+    MapTileStorage *tiles = new MapTileStorage();
+    NavTile *nav = new NavTile();
+    MPQNavFileSource src;
+    NavObstacles obstacles(&src);
+    for(uint32 x=0; x<64; x++)
+    {
+        for(uint32 y=0; y<64; y++)
+        {
+            if(x >= 2)
+                tiles->UnloadMapTile(x-2,y);
+            if(!x)
+                LoadNavSourceTile(*tiles,mapid,x,y);
+            LoadNavSourceTile(*tiles,mapid,x+1,y);
+        }
+        for(uint32 y=0; y<64; y++)
+        {
+            obstacles.ClearTriangles();
+            if(MapTile *tile = tiles->GetTile(x,y))
+                obstacles.AddTile(tile);
+            if(!nav->Build(tiles,x,y,&obstacles))
+                continue;
+            sprintf(fn,MAPSDIR"/%u_%u_%u.nav",mapid,x,y);
+            if(!nav->Save(fn))
+            {
+                printf("ERROR: could not save file %s\n",fn);
+                continue;
+            }
+            built++;
+        }
+    }
+    delete nav;
+    delete tiles;
+    printf("%u nav tiles built.\n",built);
+}
+
 void ExtractMapDependencies(void)
 {
     barGoLink *bar;
@@ -36,6 +36,7 @@ void OutSCP(const char*, SCPStorageMap&, std::string);
 void OutMD5(const char*, MD5FileMap&);
 bool ConvertDBC(void);
 void ExtractMaps(void);
+void BuildNavTiles(uint32);
 void ExtractMapDependencies(void);
 void ExtractSoundFiles(void);
 
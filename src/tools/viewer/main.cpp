@@ -20,6 +20,14 @@ tutorial, we use a lot stuff from the gui namespace.
 #include "GUI/CWMOMeshFileLoader.h"
 #include "GUI/MemoryInterface.h"
 #include "MemoryDataHolder.h"
+#include <fstream>
+#include <string>
+#include <vector>
+#if PLATFORM == PLATFORM_WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
 
 
 using namespace irr;
@@ -688,6 +696,194 @@ public:
 };
 
 
+/*
+Benchmark mode: "viewer -bench <listfile> [frames] [-soft]"
+Loads every M2/WMO file named in the list file (one per line, MPQ or data path) without any user
+interaction, runs the given number of animation frames on each mesh and prints the times taken.
+Uses the null driver, or Burning's software renderer with -soft, so it runs without a GPU.
+*/
+
+// microseconds, only for measuring differences
+static double getBenchTime(void)
+{
+#if PLATFORM == PLATFORM_WIN32
+	LARGE_INTEGER freq, count;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return count.QuadPart * 1000000.0 / freq.QuadPart;
+#else
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000000.0 + tv.tv_usec;
+#endif
+}
+
+// added as the last image loader, so the driver asks it first. it passes every image on to the
+// loader that would have been used otherwise, and sums up the time spent decoding.
+class CTimedImageLoader : public video::IImageLoader
+{
+public:
+	CTimedImageLoader(video::IVideoDriver* driver) : Time(0), Count(0), Driver(driver) {}
+
+	virtual bool isALoadableFileExtension(const io::path& filename) const
+	{
+		return findLoader(filename, 0) != 0;
+	}
+
+	virtual bool isALoadableFileFormat(io::IReadFile* file) const
+	{
+		return findLoader("", file) != 0;
+	}
+
+	virtual video::IImage* loadImage(io::IReadFile* file) const
+	{
+		video::IImageLoader* loader = findLoader(file->getFileName(), 0);
+		if (!loader)
+			loader = findLoader("", file);
+		if (!loader)
+			return 0;
+
+		double start = getBenchTime();
+		video::IImage* image = loader->loadImage(file);
+		Time += getBenchTime() - start;
+		Count++;
+		return image;
+	}
+
+	mutable double Time;
+	mutable u32 Count;
+
+private:
+	// the loader the driver would use, checked by extension or by content like the driver does
+	video::IImageLoader* findLoader(const io::path& filename, io::IReadFile* file) const
+	{
+		for (s32 i = (s32)Driver->getImageLoaderCount() - 1; i >= 0; --i)
+		{
+			video::IImageLoader* loader = Driver->getImageLoader(i);
+			if (loader == this)
+				continue;
+			if (file)
+			{
+				file->seek(0);
+				bool ok = loader->isALoadableFileFormat(file);
+				file->seek(0);
+				if (ok)
+					return loader;
+			}
+			else if (loader->isALoadableFileExtension(filename))
+				return loader;
+		}
+		return 0;
+	}
+
+	video::IVideoDriver* Driver;
+};
+
+// bytes used by the vertices and indices of all mesh buffers
+static u32 getMeshBufferMemory(scene::IMesh* mesh)
+{
+	u32 size = 0;
+	for (u32 i = 0; i < mesh->getMeshBufferCount(); i++)
+	{
+		scene::IMeshBuffer* mb = mesh->getMeshBuffer(i);
+		size += mb->getVertexCount() * video::getVertexPitchFromType(mb->getVertexType());
+		size += mb->getIndexCount() * (mb->getIndexType() == video::EIT_16BIT ? sizeof(u16) : sizeof(u32));
+	}
+	return size;
+}
+
+int runBenchmark(const char* listfile, u32 frames, bool software)
+{
+	std::vector<std::string> files;
+	std::ifstream list(listfile);
+	std::string line;
+	while (std::getline(list, line))
+	{
+		while (!line.empty() && (line[line.size()-1] == '\r' || line[line.size()-1] == ' '))
+			line.erase(line.size()-1);
+		if (!line.empty())
+			files.push_back(line);
+	}
+	if (files.empty())
+	{
+		printf("Benchmark: no files to load in '%s'\n", listfile);
+		return 1;
+	}
+
+	Device = createDevice(software ? video::EDT_BURNINGSVIDEO : video::EDT_NULL, core::dimension2d<u32>(640, 480));
+	if (!Device)
+	{
+		printf("Benchmark: could not create device\n");
+		return 1;
+	}
+
+	video::IVideoDriver* driver = Device->getVideoDriver();
+	scene::ISceneManager* smgr = Device->getSceneManager();
+	scene::CM2MeshFileLoader* m2loader = new scene::CM2MeshFileLoader(Device);
+	smgr->addExternalMeshLoader(m2loader);
+	m2loader->drop();
+	scene::CWMOMeshFileLoader* wmoloader = new scene::CWMOMeshFileLoader(Device);
+	smgr->addExternalMeshLoader(wmoloader);
+	wmoloader->drop();
+	CTimedImageLoader* imageloader = new CTimedImageLoader(driver);
+	driver->addExternalImageLoader(imageloader);
+	driver->setTextureCreationFlag(video::ETCF_ALWAYS_32_BIT, true);
+
+	double totalLoad = 0, totalSkin = 0;
+	u32 totalMemory = 0, totalFrames = 0, loaded = 0;
+
+	printf("%-60s %10s %8s %10s %12s\n", "file", "load ms", "buffers", "KB", "us/frame");
+	for (u32 f = 0; f < files.size(); f++)
+	{
+		double start = getBenchTime();
+		io::IReadFile* file = io::IrrCreateIReadFileBasic(Device, files[f].c_str());
+		scene::IAnimatedMesh* mesh = file ? smgr->getMesh(file) : 0;
+		double loadTime = getBenchTime() - start;
+		if (file)
+			file->drop();
+		if (!mesh)
+		{
+			printf("%-60s could not be loaded\n", files[f].c_str());
+			continue;
+		}
+
+		// step through the whole animation range, every getMesh() call animates and skins the mesh
+		double skinTime = 0;
+		u32 frameCount = mesh->getFrameCount();
+		for (u32 i = 0; i < frames; i++)
+		{
+			s32 frame = frameCount > 1 ? (s32)(i % frameCount) : 0;
+			start = getBenchTime();
+			mesh->getMesh(frame);
+			skinTime += getBenchTime() - start;
+		}
+
+		u32 memory = getMeshBufferMemory(mesh->getMesh(0));
+		printf("%-60s %10.2f %8u %10.1f %12.2f\n", files[f].c_str(), loadTime / 1000.0,
+			mesh->getMeshBufferCount(), memory / 1024.0f, frames ? skinTime / frames : 0.0);
+
+		totalLoad += loadTime;
+		totalSkin += skinTime;
+		totalMemory += memory;
+		totalFrames += frames;
+		loaded++;
+
+		// don't let the mesh cache answer the next request for the same file
+		smgr->getMeshCache()->removeMesh(mesh);
+	}
+
+	printf("\n%u of %u files loaded\n", loaded, (u32)files.size());
+	printf("load time:      %.2f ms total, %.2f ms per file\n", totalLoad / 1000.0, loaded ? totalLoad / 1000.0 / loaded : 0.0);
+	printf("skinning:       %.2f us per frame (%u frames)\n", totalFrames ? totalSkin / totalFrames : 0.0, totalFrames);
+	printf("mesh buffers:   %.1f KB\n", totalMemory / 1024.0f);
+	printf("texture decode: %.2f ms for %u images\n", imageloader->Time / 1000.0, imageloader->Count);
+
+	imageloader->drop();
+	Device->drop();
+	return 0;
+}
+
+
 /*
 Most of the hard work is done. We only need to create the Irrlicht Engine
 device and all the buttons, menus and toolbars. We start up the engine as
@@ -705,6 +901,20 @@ int main(int argc, char* argv[])
   log_prepare("viewerlog.txt","w");
   MemoryDataHolder::SetUseMPQ("enUS");
 
+  if(argc >= 3 && !strcmp(argv[1],"-bench"))
+  {
+    u32 frames = 100;
+    bool software = false;
+    for(int i = 3; i < argc; i++)
+    {
+      if(!strcmp(argv[i],"-soft"))
+        software = true;
+      else
+        frames = atoi(argv[i]);
+    }
+    return runBenchmark(argv[2], frames, software);
+  }
+
   FILE* f;
   f = fopen("viewer_last.txt","r");
   if(f!=NULL)